@@ -0,0 +1,427 @@
+/**
+ * @file geometry_query_server/main.cpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Command line entry of the geometry query server
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "protocol.hpp"
+#include "query_server.hpp"
+
+namespace {
+using Clock = std::chrono::steady_clock;
+namespace qs = geometry::query_server;
+
+constexpr const char* kUsage{
+    "Usage: geometry_query_server [options]\n"
+    "Answers nearest and radius queries in the binary protocol of\n"
+    "protocol.hpp, over stdin and stdout unless --socket is given.\n"
+    "\n"
+    "Dataset:\n"
+    "  --points FILE      One \"x y\" or \"x,y\" point per line, in meters\n"
+    "  --random N         N uniform random points (default 1000000)\n"
+    "  --extent METERS    Side of the random square (default 10000)\n"
+    "Server:\n"
+    "  --socket PATH      Serve connections on a Unix-domain socket\n"
+    "  --connections N    Exit after N connections (default 0, forever)\n"
+    "  --workers N        Worker threads (default 0, all hardware threads)\n"
+    "  --batch N          Most requests per batch (default 256)\n"
+    "Built-in load, over a socket pair instead of stdin or --socket:\n"
+    "  --load N           Send N requests and report end-to-end latency\n"
+    "  --window N         Requests in flight (default 256)\n"
+    "  --k N              Neighbours per nearest request (default 8)\n"
+    "  --radius METERS    Radius of radius requests (default 50)\n"
+    "  --radius-share F   Fraction of radius requests (default 0.2)\n"
+    "\n"
+    "Statistics go to stderr when the input ends.\n"};
+
+struct Options {
+  std::string points_path;
+  std::size_t random_count{1000000};
+  double extent{10000.0};
+  std::string socket_path;
+  std::size_t connections{0};
+  qs::ServerOptions server;
+  std::size_t load{0};
+  std::size_t window{256};
+  uint32_t k{8};
+  double radius{50.0};
+  double radius_share{0.2};
+};
+
+auto ParseCount(const std::string& name, const char* value) -> std::size_t {
+  char* end{nullptr};
+  errno = 0;
+  const unsigned long long count{std::strtoull(value, &end, 10)};
+  if (errno != 0 || end == value || *end != '\0' || value[0] == '-') {
+    throw std::invalid_argument("Invalid input: Bad value of " + name);
+  }
+  return static_cast<std::size_t>(count);
+}
+
+auto ParseNumber(const std::string& name, const char* value) -> double {
+  char* end{nullptr};
+  const double number{std::strtod(value, &end)};
+  if (end == value || *end != '\0' || !(number >= 0.0) ||
+      number > std::numeric_limits<double>::max()) {
+    throw std::invalid_argument("Invalid input: Bad value of " + name);
+  }
+  return number;
+}
+
+auto ParseOptions(int argc, char** argv) -> Options {
+  Options options;
+  for (int i = 1; i < argc; ++i) {
+    const std::string name{argv[i]};
+    if (name == "--help" || name == "-h") {
+      std::fputs(kUsage, stdout);
+      std::exit(0);
+    }
+    if (i + 1 == argc) {
+      throw std::invalid_argument("Invalid input: Missing value of " + name);
+    }
+    const char* value{argv[++i]};
+    if (name == "--points") {
+      options.points_path = value;
+    } else if (name == "--random") {
+      options.random_count = ParseCount(name, value);
+    } else if (name == "--extent") {
+      options.extent = ParseNumber(name, value);
+    } else if (name == "--socket") {
+      options.socket_path = value;
+    } else if (name == "--connections") {
+      options.connections = ParseCount(name, value);
+    } else if (name == "--workers") {
+      options.server.worker_count = ParseCount(name, value);
+    } else if (name == "--batch") {
+      options.server.batch_size = ParseCount(name, value);
+    } else if (name == "--load") {
+      options.load = ParseCount(name, value);
+    } else if (name == "--window") {
+      options.window = std::max<std::size_t>(1, ParseCount(name, value));
+    } else if (name == "--k") {
+      options.k = static_cast<uint32_t>(ParseCount(name, value));
+    } else if (name == "--radius") {
+      options.radius = ParseNumber(name, value);
+    } else if (name == "--radius-share") {
+      options.radius_share = std::min(1.0, ParseNumber(name, value));
+    } else {
+      throw std::invalid_argument("Invalid input: Unknown option " + name);
+    }
+  }
+  if (options.load > std::numeric_limits<uint32_t>::max()) {
+    throw std::invalid_argument("Invalid input: Too many load requests");
+  }
+  return options;
+}
+
+auto LoadPoints(const Options& options) -> std::vector<geometry::Point2D> {
+  std::vector<geometry::Point2D> points;
+  if (options.points_path.empty()) {
+    std::mt19937_64 random(1);
+    std::uniform_real_distribution<double> coordinate(0.0, options.extent);
+    points.reserve(options.random_count);
+    for (std::size_t i = 0; i < options.random_count; ++i) {
+      const double x{coordinate(random)};
+      points.emplace_back(x, coordinate(random));
+    }
+    return points;
+  }
+  std::ifstream file(options.points_path);
+  if (!file) {
+    throw std::invalid_argument("Invalid input: Cannot open " +
+                                options.points_path);
+  }
+  std::string line;
+  for (std::size_t number = 1; std::getline(file, line); ++number) {
+    std::replace(line.begin(), line.end(), ',', ' ');
+    std::istringstream fields(line);
+    double x;
+    double y;
+    if (!(fields >> x)) {
+      continue;  // Blank line
+    }
+    if (!(fields >> y)) {
+      throw std::invalid_argument("Invalid input: Bad point at line " +
+                                  std::to_string(number));
+    }
+    points.emplace_back(x, y);
+  }
+  return points;
+}
+
+auto Microseconds(uint64_t nanoseconds) -> double {
+  return static_cast<double>(nanoseconds) / 1000.0;
+}
+
+auto PrintLatencies(const char* name, const qs::ServeStats& stats) -> void {
+  std::fprintf(stderr, "%s latency us: p50 %.1f p99 %.1f p999 %.1f max %.1f\n",
+               name, Microseconds(stats.GetLatency(0.5)),
+               Microseconds(stats.GetLatency(0.99)),
+               Microseconds(stats.GetLatency(0.999)),
+               Microseconds(stats.GetLatency(1.0)));
+}
+
+auto PrintStats(const qs::ServeStats& stats) -> void {
+  const auto requests{static_cast<double>(stats.requests)};
+  std::fprintf(stderr,
+               "requests %zu (bad %zu) in %.3f s: %.0f requests/s, "
+               "%.1f neighbours/request\n",
+               stats.requests, stats.bad_requests, stats.seconds,
+               stats.GetThroughput(),
+               static_cast<double>(stats.neighbours) / std::max(1.0, requests));
+  std::fprintf(stderr, "batches %zu: %.1f requests/batch\n", stats.batches,
+               requests / std::max(1.0, static_cast<double>(stats.batches)));
+  PrintLatencies("server", stats);
+}
+
+/**
+ * @brief Pipelined client that keeps up to window requests in flight.
+ */
+auto RunLoad(const Options& options, const geometry::GridIndex& index,
+             int socket) -> std::vector<uint64_t> {
+  const std::size_t count{options.load};
+  std::vector<Clock::time_point> sent_at(count);
+  std::mutex mutex;
+  std::condition_variable window_open;
+  std::size_t in_flight{0};
+  bool closed{false};
+
+  std::thread sender([&] {
+    std::mt19937_64 random(2);
+    const double width{static_cast<double>(index.GetColumnCount()) *
+                       index.GetCellSize()};
+    const double height{static_cast<double>(index.GetRowCount()) *
+                        index.GetCellSize()};
+    std::uniform_real_distribution<double> x(index.GetMinX(),
+                                             index.GetMinX() + width);
+    std::uniform_real_distribution<double> y(index.GetMinY(),
+                                             index.GetMinY() + height);
+    std::bernoulli_distribution is_radius(options.radius_share);
+    std::vector<uint8_t> frames;
+    for (std::size_t first = 0; first < count;) {
+      std::size_t burst;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        window_open.wait(lock,
+                         [&] { return closed || in_flight < options.window; });
+        if (closed) {
+          return;
+        }
+        burst = std::min(options.window - in_flight, count - first);
+        in_flight += burst;
+        const auto now{Clock::now()};
+        std::fill(sent_at.begin() + static_cast<std::ptrdiff_t>(first),
+                  sent_at.begin() + static_cast<std::ptrdiff_t>(first + burst),
+                  now);
+      }
+      frames.assign(burst * qs::kRequestSize, 0);
+      for (std::size_t i = 0; i < burst; ++i) {
+        qs::Request request;
+        request.id = static_cast<uint32_t>(first + i);
+        request.x = x(random);
+        request.y = y(random);
+        if (is_radius(random)) {
+          request.type = qs::QueryType::kRadius;
+          request.radius = options.radius;
+        } else {
+          request.limit = options.k;
+        }
+        qs::EncodeRequest(request, frames.data() + (i * qs::kRequestSize));
+      }
+      for (std::size_t offset = 0; offset < frames.size();) {
+        const ssize_t written{
+            ::write(socket, frames.data() + offset, frames.size() - offset)};
+        if (written < 0 && errno != EINTR) {
+          std::perror("geometry_query_server: load write");
+          ::shutdown(socket, SHUT_WR);
+          return;
+        }
+        offset += static_cast<std::size_t>(std::max<ssize_t>(written, 0));
+      }
+      first += burst;
+    }
+    ::shutdown(socket, SHUT_WR);
+  });
+
+  std::vector<uint64_t> latencies;
+  latencies.reserve(count);
+  std::vector<uint8_t> buffer;
+  std::size_t consumed{0};
+  std::vector<uint8_t> chunk(std::size_t{1} << 16);
+  for (;;) {
+    const ssize_t size{::read(socket, chunk.data(), chunk.size())};
+    if (size < 0 && errno == EINTR) {
+      continue;
+    }
+    if (size <= 0) {
+      break;
+    }
+    buffer.insert(buffer.end(), chunk.begin(), chunk.begin() + size);
+    const auto now{Clock::now()};
+    std::size_t answered{0};
+    while (buffer.size() - consumed >= qs::kResponseHeaderSize) {
+      const auto header{qs::DecodeResponseHeader(buffer.data() + consumed)};
+      const std::size_t size_with_neighbours{
+          qs::kResponseHeaderSize + (header.count * qs::kNeighbourSize)};
+      if (buffer.size() - consumed < size_with_neighbours) {
+        break;
+      }
+      consumed += size_with_neighbours;
+      if (header.id < count) {
+        const std::lock_guard<std::mutex> lock(mutex);
+        latencies.push_back(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                now - sent_at[header.id])
+                .count()));
+      }
+      ++answered;
+    }
+    buffer.erase(buffer.begin(),
+                 buffer.begin() + static_cast<std::ptrdiff_t>(consumed));
+    consumed = 0;
+    {
+      const std::lock_guard<std::mutex> lock(mutex);
+      in_flight -= std::min(in_flight, answered);
+    }
+    window_open.notify_one();
+  }
+  {
+    // Also releases the sender when the server went away early.
+    const std::lock_guard<std::mutex> lock(mutex);
+    closed = true;
+  }
+  window_open.notify_one();
+  sender.join();
+  std::sort(latencies.begin(), latencies.end());
+  return latencies;
+}
+
+auto ServeLoad(const Options& options, const qs::QueryServer& server)
+    -> void {
+  int sockets[2];
+  if (::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) != 0) {
+    throw std::system_error(errno, std::generic_category(), "socketpair");
+  }
+  std::exception_ptr error;
+  qs::ServeStats stats;
+  std::thread serving([&] {
+    try {
+      stats = server.Serve(sockets[1], sockets[1]);
+    } catch (...) {
+      error = std::current_exception();
+    }
+    ::close(sockets[1]);
+  });
+  qs::ServeStats client;
+  client.latencies = RunLoad(options, server.GetIndex(), sockets[0]);
+  serving.join();
+  ::close(sockets[0]);
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  PrintStats(stats);
+  PrintLatencies("client", client);
+  if (client.latencies.size() != options.load) {
+    throw std::logic_error("Invalid state: Missing responses");
+  }
+}
+
+auto ServeSocket(const Options& options, const qs::QueryServer& server)
+    -> void {
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  if (options.socket_path.size() >= sizeof(address.sun_path)) {
+    throw std::invalid_argument("Invalid input: Socket path too long");
+  }
+  std::memcpy(address.sun_path, options.socket_path.c_str(),
+              options.socket_path.size() + 1);
+  const int listener{::socket(AF_UNIX, SOCK_STREAM, 0)};
+  if (listener < 0) {
+    throw std::system_error(errno, std::generic_category(), "socket");
+  }
+  ::unlink(options.socket_path.c_str());
+  if (::bind(listener, reinterpret_cast<const sockaddr*>(&address),
+             sizeof(address)) != 0 ||
+      ::listen(listener, 8) != 0) {
+    const int error{errno};
+    ::close(listener);
+    throw std::system_error(error, std::generic_category(), "bind");
+  }
+  std::fprintf(stderr, "listening on %s\n", options.socket_path.c_str());
+  for (std::size_t served = 0;
+       options.connections == 0 || served < options.connections; ++served) {
+    const int connection{::accept(listener, nullptr, nullptr)};
+    if (connection < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      const int error{errno};
+      ::close(listener);
+      throw std::system_error(error, std::generic_category(), "accept");
+    }
+    try {
+      PrintStats(server.Serve(connection, connection));
+    } catch (const std::system_error& error) {
+      // A client that goes away only ends its own connection.
+      std::fprintf(stderr, "connection: %s\n", error.what());
+    }
+    ::close(connection);
+  }
+  ::close(listener);
+  ::unlink(options.socket_path.c_str());
+}
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+  try {
+    const Options options{ParseOptions(argc, argv)};
+    // Write errors are reported by the server instead.
+    std::signal(SIGPIPE, SIG_IGN);
+    const auto start{Clock::now()};
+    const qs::QueryServer server(LoadPoints(options), options.server);
+    std::fprintf(stderr, "indexed %zu points in %.3f s\n",
+                 server.GetIndex().GetSize(),
+                 std::chrono::duration<double>(Clock::now() - start).count());
+    if (options.load != 0) {
+      ServeLoad(options, server);
+    } else if (!options.socket_path.empty()) {
+      ServeSocket(options, server);
+    } else {
+      PrintStats(server.Serve(STDIN_FILENO, STDOUT_FILENO));
+    }
+  } catch (const std::exception& error) {
+    std::fprintf(stderr, "geometry_query_server: %s\n", error.what());
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file geometry_query_server/protocol.cpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Binary wire format of the geometry query server
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "protocol.hpp"
+
+#include <cstring>
+
+namespace {
+auto Store32(uint32_t value, uint8_t* bytes) -> void {
+  for (unsigned i = 0; i < 4U; ++i) {
+    bytes[i] = static_cast<uint8_t>(value >> (8U * i));
+  }
+}
+
+auto Store64(double value, uint8_t* bytes) -> void {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  for (unsigned i = 0; i < 8U; ++i) {
+    bytes[i] = static_cast<uint8_t>(bits >> (8U * i));
+  }
+}
+
+auto Load32(const uint8_t* bytes) -> uint32_t {
+  uint32_t value{0};
+  for (unsigned i = 0; i < 4U; ++i) {
+    value |= static_cast<uint32_t>(bytes[i]) << (8U * i);
+  }
+  return value;
+}
+
+auto Load64(const uint8_t* bytes) -> double {
+  uint64_t bits{0};
+  for (unsigned i = 0; i < 8U; ++i) {
+    bits |= static_cast<uint64_t>(bytes[i]) << (8U * i);
+  }
+  double value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+}  // namespace
+
+namespace geometry {
+namespace query_server {
+
+auto EncodeRequest(const Request& request, uint8_t* bytes) -> void {
+  std::memset(bytes, 0, kRequestSize);
+  Store32(request.id, bytes);
+  bytes[4] = static_cast<uint8_t>(request.type);
+  Store32(request.limit, bytes + 8);
+  Store64(request.x, bytes + 12);
+  Store64(request.y, bytes + 20);
+  Store64(request.radius, bytes + 28);
+}
+
+auto DecodeRequest(const uint8_t* bytes) -> Request {
+  Request request;
+  request.id = Load32(bytes);
+  request.type = static_cast<QueryType>(bytes[4]);
+  request.limit = Load32(bytes + 8);
+  request.x = Load64(bytes + 12);
+  request.y = Load64(bytes + 20);
+  request.radius = Load64(bytes + 28);
+  return request;
+}
+
+auto AppendResponseHeader(const ResponseHeader& header,
+                          std::vector<uint8_t>& buffer) -> void {
+  const std::size_t offset{buffer.size()};
+  buffer.resize(offset + kResponseHeaderSize, 0);
+  Store32(header.id, buffer.data() + offset);
+  buffer[offset + 4] = static_cast<uint8_t>(header.status);
+  Store32(header.count, buffer.data() + offset + 8);
+}
+
+auto AppendNeighbour(uint32_t index, double distance,
+                     std::vector<uint8_t>& buffer) -> void {
+  const std::size_t offset{buffer.size()};
+  buffer.resize(offset + kNeighbourSize);
+  Store32(index, buffer.data() + offset);
+  Store64(distance, buffer.data() + offset + 4);
+}
+
+auto DecodeResponseHeader(const uint8_t* bytes) -> ResponseHeader {
+  ResponseHeader header;
+  header.id = Load32(bytes);
+  header.status = static_cast<Status>(bytes[4]);
+  header.count = Load32(bytes + 8);
+  return header;
+}
+
+auto DecodeNeighbour(const uint8_t* bytes, uint32_t& index, double& distance)
+    -> void {
+  index = Load32(bytes);
+  distance = Load64(bytes + 4);
+}
+
+}  // namespace query_server
+}  // namespace geometry
@@ -0,0 +1,120 @@
+/**
+ * @file geometry_query_server/protocol.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Binary wire format of the geometry query server
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY_QUERY_SERVER__PROTOCOL_HPP_
+#define GEOMETRY_QUERY_SERVER__PROTOCOL_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace geometry {
+namespace query_server {
+// Every field is little-endian. A request is a fixed 36 byte frame:
+//   u32 id, u8 type, u8[3] reserved, u32 limit, f64 x, f64 y, f64 radius
+// A response is a 12 byte header followed by count 12 byte neighbours:
+//   u32 id, u8 status, u8[3] reserved, u32 count
+//   u32 index, f64 distance in meters
+// Responses carry the id of their request and may arrive out of order.
+
+constexpr std::size_t kRequestSize{36};         ///< Bytes per request
+constexpr std::size_t kResponseHeaderSize{12};  ///< Bytes per response header
+constexpr std::size_t kNeighbourSize{12};       ///< Bytes per neighbour
+
+/**
+ * @brief The enum class for query types.
+ */
+enum class QueryType : uint8_t {
+  kNearest = 1,  ///< The limit nearest points, limit at least 1
+  kRadius = 2    ///< Points within radius, nearest first, limit 0 for all
+};
+
+/**
+ * @brief The enum class for response statuses.
+ */
+enum class Status : uint8_t {
+  kOk = 0,         ///< Answered
+  kBadRequest = 1  ///< Unknown type or invalid field, no neighbours
+};
+
+/**
+ * @brief A decoded request. The type is not validated.
+ */
+struct Request {
+  uint32_t id{0};                      ///< Echoed in the response
+  QueryType type{QueryType::kNearest}; ///< Query type
+  uint32_t limit{0};                   ///< Neighbour count or limit
+  double x{0.0};                       ///< Query x in meters
+  double y{0.0};                       ///< Query y in meters
+  double radius{0.0};                  ///< At most 1e9 meters, kRadius only
+};
+
+/**
+ * @brief A decoded response header.
+ */
+struct ResponseHeader {
+  uint32_t id{0};              ///< Request id
+  Status status{Status::kOk};  ///< Status
+  uint32_t count{0};           ///< Number of neighbours that follow
+};
+
+/**
+ * @brief Encode a request into kRequestSize bytes.
+ * @param request The request.
+ * @param bytes The output bytes.
+ */
+auto EncodeRequest(const Request& request, uint8_t* bytes) -> void;
+
+/**
+ * @brief Decode a request from kRequestSize bytes.
+ * @param bytes The input bytes.
+ * @return Request The request.
+ */
+[[nodiscard]] auto DecodeRequest(const uint8_t* bytes) -> Request;
+
+/**
+ * @brief Append a response header to a buffer.
+ * @param header The header.
+ * @param buffer The buffer.
+ */
+auto AppendResponseHeader(const ResponseHeader& header,
+                          std::vector<uint8_t>& buffer) -> void;
+
+/**
+ * @brief Append a neighbour to a buffer.
+ * @param index The input index of the point.
+ * @param distance The distance in meters.
+ * @param buffer The buffer.
+ */
+auto AppendNeighbour(uint32_t index, double distance,
+                     std::vector<uint8_t>& buffer) -> void;
+
+/**
+ * @brief Decode a response header from kResponseHeaderSize bytes.
+ * @param bytes The input bytes.
+ * @return ResponseHeader The header.
+ */
+[[nodiscard]] auto DecodeResponseHeader(const uint8_t* bytes)
+    -> ResponseHeader;
+
+/**
+ * @brief Decode a neighbour from kNeighbourSize bytes.
+ * @param bytes The input bytes.
+ * @param index The input index of the point.
+ * @param distance The distance in meters.
+ */
+auto DecodeNeighbour(const uint8_t* bytes, uint32_t& index, double& distance)
+    -> void;
+}  // namespace query_server
+}  // namespace geometry
+
+#endif  // GEOMETRY_QUERY_SERVER__PROTOCOL_HPP_
@@ -0,0 +1,367 @@
+/**
+ * @file geometry_query_server/query_server.cpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Batched nearest and radius query server over a GridIndex
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "query_server.hpp"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include "geometry/knn_join.hpp"
+#include "protocol.hpp"
+
+namespace {
+using Clock = std::chrono::steady_clock;
+using geometry::query_server::QueryType;
+using geometry::query_server::Request;
+using geometry::query_server::Status;
+
+constexpr std::size_t kReadSize{std::size_t{1} << 16};
+constexpr std::size_t kQueuedBatchesPerWorker{4};
+constexpr double kMaxRadius{1e9};  // Meters, well inside the Distance range
+
+/**
+ * @brief Bounded multi-producer multi-consumer queue.
+ */
+template <typename T>
+class BlockingQueue {
+ public:
+  explicit BlockingQueue(std::size_t capacity) : capacity_(capacity) {}
+
+  auto Push(T item) -> void {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_.wait(lock, [this] { return items_.size() < capacity_; });
+    items_.push_back(std::move(item));
+    not_empty_.notify_one();
+  }
+
+  /**
+   * @brief Wait for an item, false once the queue is closed and drained.
+   */
+  auto Pop(T& item) -> bool {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this] { return !items_.empty() || closed_; });
+    if (items_.empty()) {
+      return false;
+    }
+    item = std::move(items_.front());
+    items_.pop_front();
+    not_full_.notify_one();
+    return true;
+  }
+
+  auto Close() -> void {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+    not_empty_.notify_all();
+  }
+
+ private:
+  std::mutex mutex_;                    ///< Guards the members below
+  std::condition_variable not_empty_;  ///< Signalled on push and close
+  std::condition_variable not_full_;   ///< Signalled on pop
+  std::deque<T> items_;                ///< Queued items
+  std::size_t capacity_;               ///< Most queued items
+  bool closed_{false};                 ///< No more pushes
+};
+
+/**
+ * @brief Requests completed by one read, answered together.
+ */
+struct Batch {
+  std::vector<Request> requests;   ///< Requests in arrival order
+  Clock::time_point received;      ///< End of the read that completed them
+  std::vector<uint8_t> response;   ///< Encoded responses
+  std::size_t bad_requests{0};     ///< Requests answered with kBadRequest
+  std::size_t neighbours{0};       ///< Neighbours in the response
+};
+
+/**
+ * @brief Per worker state reused across batches.
+ */
+class Worker {
+ public:
+  Worker(const geometry::GridIndex& index,
+         const geometry::query_server::ServerOptions& options)
+      : index_(index), options_(options) {}
+
+  auto Answer(Batch& batch) -> void {
+    const auto& requests{batch.requests};
+    // Nearest queries of one batch go through one kNN join per distinct k,
+    // which visits them in spatial order.
+    nearest_.clear();
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+      if (requests[i].type == QueryType::kNearest && IsValid(requests[i])) {
+        nearest_.push_back(static_cast<uint32_t>(i));
+      }
+    }
+    std::stable_sort(nearest_.begin(), nearest_.end(),
+                     [&requests](uint32_t left, uint32_t right) {
+                       return requests[left].limit < requests[right].limit;
+                     });
+    rows_.assign(requests.size(), {0, 0});
+    joins_.clear();
+    for (std::size_t first = 0; first < nearest_.size();) {
+      const uint32_t k{requests[nearest_[first]].limit};
+      queries_.clear();
+      std::size_t last{first};
+      for (; last < nearest_.size() && requests[nearest_[last]].limit == k;
+           ++last) {
+        const auto& request{requests[nearest_[last]]};
+        rows_[nearest_[last]] = {joins_.size(), queries_.size()};
+        queries_.emplace_back(request.x, request.y);
+      }
+      geometry::KnnJoinOptions join_options;
+      join_options.k = k;
+      join_options.thread_count = 1;
+      join_options.batch_size = options_.batch_size;
+      joins_.push_back(geometry::KnnJoin(queries_, index_, join_options));
+      first = last;
+    }
+
+    batch.response.clear();
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+      const auto& request{requests[i]};
+      if (!IsValid(request)) {
+        geometry::query_server::AppendResponseHeader(
+            {request.id, Status::kBadRequest, 0}, batch.response);
+        ++batch.bad_requests;
+      } else if (request.type == QueryType::kNearest) {
+        AppendNearest(request, joins_[rows_[i].first], rows_[i].second,
+                      batch);
+      } else {
+        AppendRadius(request, batch);
+      }
+    }
+  }
+
+ private:
+  auto IsValid(const Request& request) const -> bool {
+    if (!std::isfinite(request.x) || !std::isfinite(request.y) ||
+        request.limit > options_.max_limit) {
+      return false;
+    }
+    if (request.type == QueryType::kNearest) {
+      return request.limit != 0;
+    }
+    return request.type == QueryType::kRadius && request.radius >= 0.0 &&
+           request.radius <= kMaxRadius;
+  }
+
+  static auto AppendNearest(const Request& request,
+                            const geometry::KnnJoinResult& join,
+                            std::size_t row, Batch& batch) -> void {
+    const std::size_t first{row * join.k};
+    uint32_t count{0};
+    while (count < join.k && join.indices[first + count] !=
+                                 geometry::KnnJoinResult::kInvalidIndex) {
+      ++count;
+    }
+    geometry::query_server::AppendResponseHeader(
+        {request.id, Status::kOk, count}, batch.response);
+    for (uint32_t rank = 0; rank < count; ++rank) {
+      geometry::query_server::AppendNeighbour(
+          join.indices[first + rank],
+          join.distances[first + rank].GetValue(
+              geometry::Distance::Type::kMeter),
+          batch.response);
+    }
+    batch.neighbours += count;
+  }
+
+  auto AppendRadius(const Request& request, Batch& batch) -> void {
+    matches_.clear();
+    index_.ForEachInRadius(geometry::Point2D(request.x, request.y),
+                           geometry::Distance(request.radius),
+                           [this](uint32_t index, double squared) {
+                             matches_.emplace_back(squared, index);
+                           });
+    std::size_t count{matches_.size()};
+    if (request.limit != 0 && count > request.limit) {
+      count = request.limit;
+      std::partial_sort(matches_.begin(), matches_.begin() + count,
+                        matches_.end());
+    } else {
+      std::sort(matches_.begin(), matches_.end());
+    }
+    geometry::query_server::AppendResponseHeader(
+        {request.id, Status::kOk, static_cast<uint32_t>(count)},
+        batch.response);
+    for (std::size_t i = 0; i < count; ++i) {
+      geometry::query_server::AppendNeighbour(
+          matches_[i].second, std::sqrt(matches_[i].first), batch.response);
+    }
+    batch.neighbours += count;
+  }
+
+  const geometry::GridIndex& index_;                  ///< Shared index
+  const geometry::query_server::ServerOptions& options_;  ///< Options
+  std::vector<uint32_t> nearest_;    ///< Valid nearest requests by k
+  std::vector<std::pair<std::size_t, std::size_t>> rows_;  ///< Join, row
+  std::vector<geometry::Point2D> queries_;         ///< Queries of one join
+  std::vector<geometry::KnnJoinResult> joins_;     ///< Joins of the batch
+  std::vector<std::pair<double, uint32_t>> matches_;  ///< Radius matches
+};
+
+/**
+ * @brief Write all bytes, returning 0 or the errno of the failed write.
+ */
+auto WriteAll(int output, const uint8_t* bytes, std::size_t size) -> int {
+  while (size != 0) {
+    const ssize_t written{::write(output, bytes, size)};
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return errno;
+    }
+    bytes += written;
+    size -= static_cast<std::size_t>(written);
+  }
+  return 0;
+}
+}  // namespace
+
+namespace geometry {
+namespace query_server {
+
+auto ServeStats::GetThroughput() const -> double {
+  return seconds > 0.0 ? static_cast<double>(requests) / seconds : 0.0;
+}
+
+auto ServeStats::GetLatency(double quantile) const -> uint64_t {
+  if (latencies.empty()) {
+    return 0;
+  }
+  const double rank{std::clamp(quantile, 0.0, 1.0) *
+                    static_cast<double>(latencies.size() - 1)};
+  return latencies[static_cast<std::size_t>(std::ceil(rank))];
+}
+
+QueryServer::QueryServer(const std::vector<Point2D>& points,
+                         const ServerOptions& options)
+    : index_(points), options_(options) {
+  if (options_.batch_size == 0) {
+    throw std::invalid_argument("Invalid input: Batch size is zero");
+  }
+  if (options_.worker_count == 0) {
+    options_.worker_count =
+        std::max<std::size_t>(1, std::thread::hardware_concurrency());
+  }
+}
+
+auto QueryServer::Serve(int input, int output) const -> ServeStats {
+  ServeStats stats;
+  const auto start{Clock::now()};
+  BlockingQueue<Batch> pending(options_.worker_count *
+                               kQueuedBatchesPerWorker);
+  BlockingQueue<Batch> answered(std::numeric_limits<std::size_t>::max());
+
+  std::vector<std::thread> workers;
+  for (std::size_t i = 0; i < options_.worker_count; ++i) {
+    workers.emplace_back([this, &pending, &answered] {
+      Worker worker(index_, options_);
+      Batch batch;
+      while (pending.Pop(batch)) {
+        worker.Answer(batch);
+        answered.Push(std::move(batch));
+      }
+    });
+  }
+
+  int write_error{0};
+  std::thread writer([&] {
+    Batch batch;
+    while (answered.Pop(batch)) {
+      if (write_error != 0) {
+        continue;
+      }
+      write_error =
+          WriteAll(output, batch.response.data(), batch.response.size());
+      if (write_error != 0) {
+        continue;
+      }
+      const auto latency{std::chrono::duration_cast<std::chrono::nanoseconds>(
+          Clock::now() - batch.received)};
+      stats.latencies.insert(stats.latencies.end(), batch.requests.size(),
+                             static_cast<uint64_t>(latency.count()));
+      stats.requests += batch.requests.size();
+      stats.bad_requests += batch.bad_requests;
+      stats.neighbours += batch.neighbours;
+      stats.bytes_written += batch.response.size();
+    }
+  });
+
+  int read_error{0};
+  std::vector<uint8_t> buffer;
+  for (;;) {
+    const std::size_t kept{buffer.size()};
+    buffer.resize(kept + kReadSize);
+    const ssize_t size{::read(input, buffer.data() + kept, kReadSize)};
+    buffer.resize(kept + static_cast<std::size_t>(std::max<ssize_t>(size, 0)));
+    if (size < 0 && errno == EINTR) {
+      continue;
+    }
+    if (size <= 0) {
+      read_error = size < 0 ? errno : 0;
+      break;
+    }
+    const auto received{Clock::now()};
+    stats.bytes_read += static_cast<std::size_t>(size);
+    const std::size_t complete{buffer.size() / kRequestSize};
+    for (std::size_t first = 0; first < complete;
+         first += options_.batch_size) {
+      Batch batch;
+      batch.received = received;
+      const std::size_t last{std::min(complete, first + options_.batch_size)};
+      for (std::size_t i = first; i < last; ++i) {
+        batch.requests.push_back(
+            DecodeRequest(buffer.data() + (i * kRequestSize)));
+      }
+      pending.Push(std::move(batch));
+      ++stats.batches;
+    }
+    buffer.erase(buffer.begin(),
+                 buffer.begin() +
+                     static_cast<std::ptrdiff_t>(complete * kRequestSize));
+  }
+
+  pending.Close();
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  answered.Close();
+  writer.join();
+  stats.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+  std::sort(stats.latencies.begin(), stats.latencies.end());
+  if (read_error != 0) {
+    throw std::system_error(read_error, std::generic_category(), "read");
+  }
+  if (write_error != 0) {
+    throw std::system_error(write_error, std::generic_category(), "write");
+  }
+  return stats;
+}
+
+}  // namespace query_server
+}  // namespace geometry
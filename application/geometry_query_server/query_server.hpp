@@ -0,0 +1,105 @@
+/**
+ * @file geometry_query_server/query_server.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Batched nearest and radius query server over a GridIndex
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY_QUERY_SERVER__QUERY_SERVER_HPP_
+#define GEOMETRY_QUERY_SERVER__QUERY_SERVER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/grid_index.hpp"
+#include "geometry/point2d.hpp"
+
+namespace geometry {
+namespace query_server {
+/**
+ * @brief Options of a QueryServer.
+ */
+struct ServerOptions {
+  std::size_t worker_count{0};  ///< Worker threads, 0 for all hardware threads
+  std::size_t batch_size{256};  ///< Most requests per batch
+  std::size_t max_limit{1024};  ///< Largest accepted neighbour count or limit
+};
+
+/**
+ * @brief Counters and latencies of one Serve call. A latency runs from the
+ * read that completed a request to the write that completed its response.
+ */
+struct ServeStats {
+  std::size_t requests{0};       ///< Answered requests
+  std::size_t bad_requests{0};   ///< Requests answered with kBadRequest
+  std::size_t batches{0};        ///< Batches handed to the workers
+  std::size_t neighbours{0};     ///< Neighbours sent
+  std::size_t bytes_read{0};     ///< Request bytes
+  std::size_t bytes_written{0};  ///< Response bytes
+  double seconds{0.0};           ///< Wall time until the last response
+  std::vector<uint64_t> latencies;  ///< Nanoseconds, sorted ascending
+
+  /**
+   * @brief Get the answered requests per second.
+   * @return double The throughput.
+   */
+  [[nodiscard]] auto GetThroughput() const -> double;
+
+  /**
+   * @brief Get a latency quantile.
+   * @param quantile The quantile in [0, 1].
+   * @return uint64_t The latency in nanoseconds, 0 without requests.
+   */
+  [[nodiscard]] auto GetLatency(double quantile) const -> uint64_t;
+};
+
+/**
+ * @brief Answers nearest and radius queries over an in-memory point set. A
+ * reader thread cuts the input into batches of whatever arrived in one read,
+ * up to batch_size requests; a fixed pool of workers answers batches while
+ * later ones are still read; a writer thread sends each batch as soon as it
+ * is answered, so clients may pipeline requests.
+ */
+class QueryServer {
+ public:
+  /**
+   * @brief Construct a new QueryServer object over points.
+   * @param points The points, answered by their index.
+   * @param options The server options.
+   * @throws std::invalid_argument If a coordinate is not finite, there are
+   * more than 2^32 - 1 points or the batch size is zero.
+   */
+  explicit QueryServer(const std::vector<Point2D>& points,
+                       const ServerOptions& options = ServerOptions());
+
+  /**
+   * @brief Get the index over the points.
+   * @return const GridIndex& The index.
+   */
+  [[nodiscard]] auto GetIndex() const -> const GridIndex& { return index_; }
+
+  /**
+   * @brief Answer requests read from input until end of file, writing the
+   * responses to output. A trailing partial request is dropped.
+   * @param input The file descriptor to read requests from.
+   * @param output The file descriptor to write responses to, may be input.
+   * @return ServeStats The counters and latencies.
+   * @throws std::system_error If reading or writing fails.
+   */
+  auto Serve(int input, int output) const -> ServeStats;
+
+ protected:
+ private:
+  GridIndex index_;        ///< Index over the points
+  ServerOptions options_;  ///< Server options
+};
+}  // namespace query_server
+}  // namespace geometry
+
+#endif  // GEOMETRY_QUERY_SERVER__QUERY_SERVER_HPP_
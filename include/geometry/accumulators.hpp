@@ -0,0 +1,396 @@
+/**
+ * @file geometry/accumulators.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Mergeable streaming accumulators over Point2D streams
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__ACCUMULATORS_HPP_
+#define GEOMETRY__ACCUMULATORS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/point2d.hpp"
+
+namespace geometry {
+/**
+ * @brief Centroid of a point stream from compensated sums, so the error does
+ * not grow with the number of points. Partial accumulators of disjoint
+ * streams merge into the accumulator of their union.
+ */
+class CentroidAccumulator {
+ public:
+  /**
+   * @brief Plain state of the accumulator, to ship partials between workers.
+   */
+  struct State {
+    uint64_t count{0};           ///< Number of points
+    double sum_x{0.0};           ///< Sum of x
+    double compensation_x{0.0};  ///< Lost low-order bits of sum_x
+    double sum_y{0.0};           ///< Sum of y
+    double compensation_y{0.0};  ///< Lost low-order bits of sum_y
+  };
+
+  /**
+   * @brief Construct an empty CentroidAccumulator object.
+   */
+  CentroidAccumulator() = default;
+
+  /**
+   * @brief Construct a CentroidAccumulator object from a shipped state.
+   * @param state The state.
+   */
+  explicit CentroidAccumulator(const State& state) : state_(state) {}
+
+  /**
+   * @brief Add a point.
+   * @param point The point.
+   */
+  auto Add(const Point2D& point) -> void;
+
+  /**
+   * @brief Add count consecutive points.
+   * @param points The first point.
+   * @param count The number of points.
+   */
+  auto Add(const Point2D* points, std::size_t count) -> void;
+
+  /**
+   * @brief Add points.
+   * @param points The points.
+   */
+  auto Add(const std::vector<Point2D>& points) -> void {
+    Add(points.data(), points.size());
+  }
+
+  /**
+   * @brief Merge the accumulator of a disjoint stream.
+   * @param other The other accumulator.
+   */
+  auto Merge(const CentroidAccumulator& other) -> void;
+
+  /**
+   * @brief Get the number of points.
+   * @return uint64_t The number of points.
+   */
+  [[nodiscard]] auto GetCount() const -> uint64_t { return state_.count; }
+
+  /**
+   * @brief Get the centroid.
+   * @return Point2D The centroid.
+   * @throws std::logic_error If no point was added.
+   */
+  [[nodiscard]] auto GetCentroid() const -> Point2D;
+
+  /**
+   * @brief Get the plain state.
+   * @return const State& The state.
+   */
+  [[nodiscard]] auto GetState() const -> const State& { return state_; }
+
+ protected:
+ private:
+  State state_;  ///< Count and compensated sums
+};
+
+/**
+ * @brief Axis-aligned bounding box of a point stream.
+ */
+class BoundingBoxAccumulator {
+ public:
+  /**
+   * @brief Plain state of the accumulator, to ship partials between workers.
+   */
+  struct State {
+    uint64_t count{0};  ///< Number of points
+    double min_x{0.0};  ///< Lower x bound, meaningful if count != 0
+    double min_y{0.0};  ///< Lower y bound, meaningful if count != 0
+    double max_x{0.0};  ///< Upper x bound, meaningful if count != 0
+    double max_y{0.0};  ///< Upper y bound, meaningful if count != 0
+  };
+
+  /**
+   * @brief Construct an empty BoundingBoxAccumulator object.
+   */
+  BoundingBoxAccumulator() = default;
+
+  /**
+   * @brief Construct a BoundingBoxAccumulator object from a shipped state.
+   * @param state The state.
+   */
+  explicit BoundingBoxAccumulator(const State& state) : state_(state) {}
+
+  /**
+   * @brief Add a point.
+   * @param point The point.
+   */
+  auto Add(const Point2D& point) -> void;
+
+  /**
+   * @brief Add count consecutive points.
+   * @param points The first point.
+   * @param count The number of points.
+   */
+  auto Add(const Point2D* points, std::size_t count) -> void;
+
+  /**
+   * @brief Add points.
+   * @param points The points.
+   */
+  auto Add(const std::vector<Point2D>& points) -> void {
+    Add(points.data(), points.size());
+  }
+
+  /**
+   * @brief Merge the accumulator of another stream.
+   * @param other The other accumulator.
+   */
+  auto Merge(const BoundingBoxAccumulator& other) -> void;
+
+  /**
+   * @brief Get the number of points.
+   * @return uint64_t The number of points.
+   */
+  [[nodiscard]] auto GetCount() const -> uint64_t { return state_.count; }
+
+  /**
+   * @brief Get the lower left corner.
+   * @return Point2D The lower left corner.
+   * @throws std::logic_error If no point was added.
+   */
+  [[nodiscard]] auto GetMinCorner() const -> Point2D;
+
+  /**
+   * @brief Get the upper right corner.
+   * @return Point2D The upper right corner.
+   * @throws std::logic_error If no point was added.
+   */
+  [[nodiscard]] auto GetMaxCorner() const -> Point2D;
+
+  /**
+   * @brief Get the plain state.
+   * @return const State& The state.
+   */
+  [[nodiscard]] auto GetState() const -> const State& { return state_; }
+
+ protected:
+ private:
+  State state_;  ///< Count and bounds
+};
+
+/**
+ * @brief Nearest and farthest Distance of a point stream from a fixed
+ * reference point.
+ */
+class DistanceRangeAccumulator {
+ public:
+  /**
+   * @brief Plain state of the accumulator, to ship partials between workers.
+   */
+  struct State {
+    uint64_t count{0};        ///< Number of points
+    double reference_x{0.0};  ///< Reference x
+    double reference_y{0.0};  ///< Reference y
+    double min_squared{0.0};  ///< Least squared distance, if count != 0
+    double max_squared{0.0};  ///< Greatest squared distance, if count != 0
+  };
+
+  /**
+   * @brief Construct an empty DistanceRangeAccumulator object.
+   * @param reference The reference point.
+   */
+  explicit DistanceRangeAccumulator(const Point2D& reference);
+
+  /**
+   * @brief Construct a DistanceRangeAccumulator object from a shipped state.
+   * @param state The state.
+   */
+  explicit DistanceRangeAccumulator(const State& state) : state_(state) {}
+
+  /**
+   * @brief Add a point.
+   * @param point The point.
+   */
+  auto Add(const Point2D& point) -> void;
+
+  /**
+   * @brief Add count consecutive points.
+   * @param points The first point.
+   * @param count The number of points.
+   */
+  auto Add(const Point2D* points, std::size_t count) -> void;
+
+  /**
+   * @brief Add points.
+   * @param points The points.
+   */
+  auto Add(const std::vector<Point2D>& points) -> void {
+    Add(points.data(), points.size());
+  }
+
+  /**
+   * @brief Merge the accumulator of another stream.
+   * @param other The other accumulator.
+   * @throws std::invalid_argument If the reference points differ.
+   */
+  auto Merge(const DistanceRangeAccumulator& other) -> void;
+
+  /**
+   * @brief Get the number of points.
+   * @return uint64_t The number of points.
+   */
+  [[nodiscard]] auto GetCount() const -> uint64_t { return state_.count; }
+
+  /**
+   * @brief Get the reference point.
+   * @return Point2D The reference point.
+   */
+  [[nodiscard]] auto GetReference() const -> Point2D;
+
+  /**
+   * @brief Get the distance of the nearest point.
+   * @return Distance The least distance.
+   * @throws std::logic_error If no point was added.
+   */
+  [[nodiscard]] auto GetMin() const -> Distance;
+
+  /**
+   * @brief Get the distance of the farthest point.
+   * @return Distance The greatest distance.
+   * @throws std::logic_error If no point was added.
+   */
+  [[nodiscard]] auto GetMax() const -> Distance;
+
+  /**
+   * @brief Get the plain state.
+   * @return const State& The state.
+   */
+  [[nodiscard]] auto GetState() const -> const State& { return state_; }
+
+ protected:
+ private:
+  State state_;  ///< Count, reference and squared bounds
+};
+
+/**
+ * @brief Mean and covariance of a point stream with Welford's update. Spans
+ * are reduced with two passes and merged like partials, so long streams stay
+ * accurate far from the origin.
+ */
+class CovarianceAccumulator {
+ public:
+  /**
+   * @brief Plain state of the accumulator, to ship partials between workers.
+   */
+  struct State {
+    uint64_t count{0};      ///< Number of points
+    double mean_x{0.0};     ///< Mean x
+    double mean_y{0.0};     ///< Mean y
+    double moment_xx{0.0};  ///< Sum of squared x deviations
+    double moment_xy{0.0};  ///< Sum of x deviation times y deviation
+    double moment_yy{0.0};  ///< Sum of squared y deviations
+  };
+
+  /**
+   * @brief Symmetric 2x2 covariance matrix.
+   */
+  struct Covariance {
+    double xx{0.0};  ///< Variance of x
+    double xy{0.0};  ///< Covariance of x and y
+    double yy{0.0};  ///< Variance of y
+  };
+
+  /**
+   * @brief Construct an empty CovarianceAccumulator object.
+   */
+  CovarianceAccumulator() = default;
+
+  /**
+   * @brief Construct a CovarianceAccumulator object from a shipped state.
+   * @param state The state.
+   */
+  explicit CovarianceAccumulator(const State& state) : state_(state) {}
+
+  /**
+   * @brief Add a point.
+   * @param point The point.
+   */
+  auto Add(const Point2D& point) -> void;
+
+  /**
+   * @brief Add count consecutive points.
+   * @param points The first point.
+   * @param count The number of points.
+   */
+  auto Add(const Point2D* points, std::size_t count) -> void;
+
+  /**
+   * @brief Add points.
+   * @param points The points.
+   */
+  auto Add(const std::vector<Point2D>& points) -> void {
+    Add(points.data(), points.size());
+  }
+
+  /**
+   * @brief Merge the accumulator of a disjoint stream.
+   * @param other The other accumulator.
+   */
+  auto Merge(const CovarianceAccumulator& other) -> void;
+
+  /**
+   * @brief Get the number of points.
+   * @return uint64_t The number of points.
+   */
+  [[nodiscard]] auto GetCount() const -> uint64_t { return state_.count; }
+
+  /**
+   * @brief Get the mean.
+   * @return Point2D The mean.
+   * @throws std::logic_error If no point was added.
+   */
+  [[nodiscard]] auto GetMean() const -> Point2D;
+
+  /**
+   * @brief Get the population covariance, normalised by the count.
+   * @return Covariance The covariance.
+   * @throws std::logic_error If no point was added.
+   */
+  [[nodiscard]] auto GetCovariance() const -> Covariance;
+
+  /**
+   * @brief Get the sample covariance, normalised by the count minus one.
+   * @return Covariance The covariance.
+   * @throws std::logic_error If fewer than two points were added.
+   */
+  [[nodiscard]] auto GetSampleCovariance() const -> Covariance;
+
+  /**
+   * @brief Get the standard distance, the root mean squared distance of the
+   * points from their mean.
+   * @return Distance The standard distance.
+   * @throws std::logic_error If no point was added.
+   */
+  [[nodiscard]] auto GetStandardDistance() const -> Distance;
+
+  /**
+   * @brief Get the plain state.
+   * @return const State& The state.
+   */
+  [[nodiscard]] auto GetState() const -> const State& { return state_; }
+
+ protected:
+ private:
+  State state_;  ///< Count, mean and central moments
+};
+}  // namespace geometry
+
+#endif  // GEOMETRY__ACCUMULATORS_HPP_
@@ -0,0 +1,220 @@
+/**
+ * @file geometry/approximate_distance.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Approximate Euclidean distances with bounded relative error
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__APPROXIMATE_DISTANCE_HPP_
+#define GEOMETRY__APPROXIMATE_DISTANCE_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "geometry/point2d.hpp"
+
+namespace geometry {
+/**
+ * @brief Full precision distance, the reference of the approximations.
+ */
+struct ExactNorm {
+  static constexpr double kMaxRelativeError{0.0};  ///< Error bound
+
+  /**
+   * @brief Compute the norm of (dx, dy).
+   */
+  static auto Compute(double dx, double dy) -> double {
+    return std::sqrt((dx * dx) + (dy * dy));
+  }
+};
+
+/**
+ * @brief Reciprocal square root estimate from the exponent bits, refined by
+ * one Newton step. Branch-free integer and multiply operations only, so it
+ * vectorises where a square root does not.
+ */
+struct NewtonRsqrtNorm {
+  static constexpr double kMaxRelativeError{1.76e-3};  ///< Error bound
+
+  /**
+   * @brief Compute the norm of (dx, dy), exact zero for zero.
+   */
+  static auto Compute(double dx, double dy) -> double {
+    const double squared{(dx * dx) + (dy * dy)};
+    if (squared == 0.0) {
+      return 0.0;
+    }
+    uint64_t bits;
+    std::memcpy(&bits, &squared, sizeof(bits));
+    bits = 0x5FE6EB50C7B537A9ULL - (bits >> 1U);
+    double estimate;
+    std::memcpy(&estimate, &bits, sizeof(estimate));
+    estimate *= 1.5 - (0.5 * squared * estimate * estimate);
+    return squared * estimate;
+  }
+};
+
+/**
+ * @brief Alpha max plus beta min with two segments, the larger of two linear
+ * forms of the larger and smaller absolute coordinate difference. No square
+ * root and no multiply of the differences with each other.
+ */
+struct OctagonalNorm {
+  static constexpr double kMaxRelativeError{9.8e-3};  ///< Error bound
+
+  /**
+   * @brief Compute the norm of (dx, dy).
+   */
+  static auto Compute(double dx, double dy) -> double {
+    const double abs_x{std::abs(dx)};
+    const double abs_y{std::abs(dy)};
+    const double large{std::max(abs_x, abs_y)};
+    const double small{std::min(abs_x, abs_y)};
+    return std::max((0.99029944 * large) + (0.19698281 * small),
+                    (0.83926862 * large) + (0.56134756 * small));
+  }
+};
+
+/**
+ * @brief Single precision square root, twice as many lanes per vector as the
+ * double one. Valid while the distance stays within the float range, about
+ * 1e-19 to 1e19 meters.
+ */
+struct Float32Norm {
+  static constexpr double kMaxRelativeError{3.0e-7};  ///< Error bound
+
+  /**
+   * @brief Compute the norm of (dx, dy).
+   */
+  static auto Compute(double dx, double dy) -> double {
+    const auto x{static_cast<float>(dx)};
+    const auto y{static_cast<float>(dy)};
+    return static_cast<double>(std::sqrt((x * x) + (y * y)));
+  }
+};
+
+/**
+ * @brief Distance approximation selectable at run time.
+ */
+enum class DistanceApproximation {
+  kExact = 0,        ///< ExactNorm
+  kNewtonRsqrt = 1,  ///< NewtonRsqrtNorm
+  kOctagonal = 2,    ///< OctagonalNorm
+  kFloat32 = 3       ///< Float32Norm
+};
+
+/**
+ * @brief Approximate distance between two points, with the norm chosen at
+ * compile time.
+ * @tparam Norm ExactNorm, NewtonRsqrtNorm, OctagonalNorm or Float32Norm.
+ * @param lhs The first point.
+ * @param rhs The second point.
+ * @return double The distance, within Norm::kMaxRelativeError of the exact
+ * one.
+ */
+template <typename Norm>
+[[nodiscard]] auto ApproximateDistance(const Point2D& lhs, const Point2D& rhs)
+    -> double {
+  return Norm::Compute(lhs.GetX() - rhs.GetX(), lhs.GetY() - rhs.GetY());
+}
+
+/**
+ * @brief Approximate distances from an origin to count coordinates stored as
+ * separate x and y arrays, with the norm chosen at compile time.
+ * @tparam Norm ExactNorm, NewtonRsqrtNorm, OctagonalNorm or Float32Norm.
+ * @param origin The origin.
+ * @param xs The x coordinates.
+ * @param ys The y coordinates.
+ * @param count The number of coordinates.
+ * @param distances The count distances.
+ */
+template <typename Norm>
+auto ApproximateDistances(const Point2D& origin, const double* xs,
+                          const double* ys, std::size_t count,
+                          double* distances) -> void {
+  const double origin_x{origin.GetX()};
+  const double origin_y{origin.GetY()};
+  for (std::size_t i = 0; i < count; ++i) {
+    distances[i] = Norm::Compute(xs[i] - origin_x, ys[i] - origin_y);
+  }
+}
+
+/**
+ * @brief Approximate distances from an origin to count points, with the norm
+ * chosen at compile time.
+ * @tparam Norm ExactNorm, NewtonRsqrtNorm, OctagonalNorm or Float32Norm.
+ * @param origin The origin.
+ * @param points The first point.
+ * @param count The number of points.
+ * @param distances The count distances.
+ */
+template <typename Norm>
+auto ApproximateDistances(const Point2D& origin, const Point2D* points,
+                          std::size_t count, double* distances) -> void {
+  const double origin_x{origin.GetX()};
+  const double origin_y{origin.GetY()};
+  for (std::size_t i = 0; i < count; ++i) {
+    distances[i] = Norm::Compute(points[i].GetX() - origin_x,
+                                 points[i].GetY() - origin_y);
+  }
+}
+
+/**
+ * @brief Get the documented maximum relative error of an approximation.
+ * @param approximation The approximation.
+ * @return double The error bound.
+ */
+[[nodiscard]] auto GetMaxRelativeError(DistanceApproximation approximation)
+    -> double;
+
+/**
+ * @brief Approximate distance between two points.
+ * @param lhs The first point.
+ * @param rhs The second point.
+ * @param approximation The approximation.
+ * @return double The distance, within GetMaxRelativeError of the exact one.
+ */
+[[nodiscard]] auto ApproximateDistance(const Point2D& lhs, const Point2D& rhs,
+                                       DistanceApproximation approximation)
+    -> double;
+
+/**
+ * @brief Approximate distances from an origin to count coordinates stored as
+ * separate x and y arrays. The approximation and the kernel path are
+ * dispatched once per call.
+ * @param origin The origin.
+ * @param xs The x coordinates.
+ * @param ys The y coordinates.
+ * @param count The number of coordinates.
+ * @param distances The count distances.
+ * @param approximation The approximation.
+ */
+auto ApproximateDistances(const Point2D& origin, const double* xs,
+                          const double* ys, std::size_t count,
+                          double* distances,
+                          DistanceApproximation approximation) -> void;
+
+/**
+ * @brief Approximate distances from an origin to points. The approximation and
+ * the kernel path are dispatched once per call.
+ * @param origin The origin.
+ * @param points The points.
+ * @param approximation The approximation.
+ * @return std::vector<double> The distance to each point.
+ */
+[[nodiscard]] auto ApproximateDistances(const Point2D& origin,
+                                        const std::vector<Point2D>& points,
+                                        DistanceApproximation approximation)
+    -> std::vector<double>;
+}  // namespace geometry
+
+#endif  // GEOMETRY__APPROXIMATE_DISTANCE_HPP_
@@ -0,0 +1,256 @@
+/**
+ * @file geometry/concurrent_grid_index.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Uniform grid over moving points with lock-free readers
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__CONCURRENT_GRID_INDEX_HPP_
+#define GEOMETRY__CONCURRENT_GRID_INDEX_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/point2d.hpp"
+
+namespace geometry {
+/**
+ * @brief New position of an object in a ConcurrentGridIndex.
+ */
+struct PositionUpdate {
+  uint32_t id;       ///< Object id, below the capacity of the index
+  Point2D position;  ///< New position
+};
+
+/**
+ * @brief Uniform grid over objects that move while being queried. Every cell
+ * publishes an immutable, versioned snapshot of its objects through an atomic
+ * pointer. Readers never block: they announce the current epoch, load the
+ * snapshots they need and scan them. Writers apply batches under a writer-only
+ * mutex, republish every touched cell once per batch and retire the replaced
+ * snapshots, which are freed once no reader announced an epoch that could
+ * still see them. Each of the first 1024 concurrent readers announces its
+ * epoch in a slot of its own; readers beyond that share one counted slot,
+ * which holds back reclamation until all of them have left. A query sees
+ * every cell at some version between its start and end, so an object moved
+ * during a query may be reported from both or neither of its cells; objects
+ * that do not move are always reported.
+ * Point2D coordinates are interpreted in meters, and positions outside the
+ * grid bounds fall into its border cells.
+ */
+class ConcurrentGridIndex {
+ public:
+  /**
+   * @brief Construct a new ConcurrentGridIndex object.
+   * @param min_corner The lower left corner of the grid.
+   * @param max_corner The upper right corner of the grid.
+   * @param cell_size The cell edge length.
+   * @param capacity The number of object ids, ids are [0, capacity).
+   * @throws std::invalid_argument If a corner is not finite or inverted, the
+   * cell size is not positive, the grid has more than 2^26 cells or the
+   * capacity exceeds 2^32 - 1.
+   */
+  ConcurrentGridIndex(const Point2D& min_corner, const Point2D& max_corner,
+                      const Distance& cell_size, std::size_t capacity);
+
+  /**
+   * @brief Destroy the ConcurrentGridIndex object. No query may be running.
+   */
+  ~ConcurrentGridIndex();
+
+  ConcurrentGridIndex(const ConcurrentGridIndex&) = delete;
+  auto operator=(const ConcurrentGridIndex&) -> ConcurrentGridIndex& = delete;
+  ConcurrentGridIndex(ConcurrentGridIndex&&) = delete;
+  auto operator=(ConcurrentGridIndex&&) -> ConcurrentGridIndex& = delete;
+
+  /**
+   * @brief Insert or move objects. A later update of the same id in the batch
+   * wins. The batch is validated before anything is applied.
+   * @param updates The new positions.
+   * @throws std::invalid_argument If an id is out of range or a coordinate is
+   * not finite.
+   */
+  auto Update(const std::vector<PositionUpdate>& updates) -> void;
+
+  /**
+   * @brief Remove objects. Ids that are not indexed are ignored.
+   * @param ids The ids to remove.
+   * @throws std::invalid_argument If an id is out of range.
+   */
+  auto Remove(const std::vector<uint32_t>& ids) -> void;
+
+  /**
+   * @brief Get the number of indexed objects.
+   * @return std::size_t The number of objects.
+   */
+  [[nodiscard]] auto GetSize() const -> std::size_t {
+    return size_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Get the number of object ids.
+   * @return std::size_t The capacity.
+   */
+  [[nodiscard]] auto GetCapacity() const -> std::size_t {
+    return cell_of_.size();
+  }
+
+  /**
+   * @brief Get the number of cell columns.
+   * @return std::size_t The number of columns.
+   */
+  [[nodiscard]] auto GetColumnCount() const -> std::size_t { return columns_; }
+
+  /**
+   * @brief Get the number of cell rows.
+   * @return std::size_t The number of rows.
+   */
+  [[nodiscard]] auto GetRowCount() const -> std::size_t { return rows_; }
+
+  /**
+   * @brief Get the version of a cell, raised every time it is republished.
+   * @param column The column.
+   * @param row The row.
+   * @return uint64_t The version, 0 before the first publication.
+   */
+  [[nodiscard]] auto GetCellVersion(std::size_t column, std::size_t row) const
+      -> uint64_t;
+
+  /**
+   * @brief Visit every object within radius of center without blocking.
+   * @param center The query point.
+   * @param radius The query radius.
+   * @param visitor Called as visitor(id, squared_distance). It must not
+   * update the index.
+   */
+  template <typename Visitor>
+  auto ForEachInRadius(const Point2D& center, const Distance& radius,
+                       Visitor&& visitor) const -> void {
+    const double range{radius.GetValue(Distance::Type::kMeter)};
+    const double squared_range{range * range};
+    const double x{center.GetX()};
+    const double y{center.GetY()};
+    const std::size_t first_column{GetColumn(x - range)};
+    const std::size_t last_column{GetColumn(x + range)};
+    const std::size_t first_row{GetRow(y - range)};
+    const std::size_t last_row{GetRow(y + range)};
+    const ReadGuard guard(*this);
+    for (std::size_t row = first_row; row <= last_row; ++row) {
+      for (std::size_t column = first_column; column <= last_column;
+           ++column) {
+        const CellSnapshot* snapshot{
+            cells_[(row * columns_) + column].load(std::memory_order_seq_cst)};
+        if (snapshot == nullptr) {
+          continue;
+        }
+        const std::size_t count{snapshot->ids.size()};
+        for (std::size_t slot = 0; slot < count; ++slot) {
+          const double dx{snapshot->xs[slot] - x};
+          const double dy{snapshot->ys[slot] - y};
+          const double squared{(dx * dx) + (dy * dy)};
+          if (squared <= squared_range) {
+            visitor(snapshot->ids[slot], squared);
+          }
+        }
+      }
+    }
+  }
+
+ protected:
+ private:
+  /**
+   * @brief Immutable contents of a cell.
+   */
+  struct CellSnapshot {
+    uint64_t version{0};
+    std::vector<uint32_t> ids;
+    std::vector<double> xs;
+    std::vector<double> ys;
+  };
+
+  /**
+   * @brief Epoch announced by a reader, 0 while idle. Padded to a cache line
+   * so readers on different slots do not share lines.
+   */
+  struct alignas(64) ReaderSlot {
+    std::atomic<uint64_t> epoch{0};
+  };
+
+  /**
+   * @brief Announces an epoch for the lifetime of a query.
+   */
+  class ReadGuard {
+   public:
+    explicit ReadGuard(const ConcurrentGridIndex& index)
+        : index_(index), slot_(index.EnterRead()) {}
+    ~ReadGuard() { index_.ExitRead(slot_); }
+    ReadGuard(const ReadGuard&) = delete;
+    auto operator=(const ReadGuard&) -> ReadGuard& = delete;
+    ReadGuard(ReadGuard&&) = delete;
+    auto operator=(ReadGuard&&) -> ReadGuard& = delete;
+
+   private:
+    const ConcurrentGridIndex& index_;
+    std::size_t slot_;
+  };
+
+  [[nodiscard]] auto GetColumn(double x) const -> std::size_t {
+    return Clamp((x - min_x_) * inverse_cell_size_, columns_);
+  }
+
+  [[nodiscard]] auto GetRow(double y) const -> std::size_t {
+    return Clamp((y - min_y_) * inverse_cell_size_, rows_);
+  }
+
+  static auto Clamp(double cell, std::size_t count) -> std::size_t {
+    if (!(cell > 0.0)) {
+      return 0;
+    }
+    return std::min(static_cast<std::size_t>(cell), count - 1);
+  }
+
+  auto EnterRead() const -> std::size_t;
+  auto ExitRead(std::size_t slot) const -> void;
+  auto MoveTo(uint32_t id, uint32_t cell) -> void;
+  auto Publish() -> void;
+  auto Reclaim() -> void;
+
+  double min_x_{0.0};              ///< Lower x bound
+  double min_y_{0.0};              ///< Lower y bound
+  double inverse_cell_size_{1.0};  ///< Cells per meter
+  std::size_t columns_{1};         ///< Number of cell columns
+  std::size_t rows_{1};            ///< Number of cell rows
+  std::atomic<std::size_t> size_{0};  ///< Number of indexed objects
+
+  // Shared with readers.
+  std::unique_ptr<std::atomic<const CellSnapshot*>[]> cells_;
+  std::unique_ptr<ReaderSlot[]> reader_slots_;
+  alignas(64) mutable std::atomic<uint64_t> shared_slot_{0};
+  alignas(64) std::atomic<uint64_t> epoch_{1};
+
+  // Owned by the writer holding writer_mutex_.
+  std::mutex writer_mutex_;
+  std::vector<uint32_t> cell_of_;        ///< Cell of every id or none
+  std::vector<uint32_t> slot_of_;        ///< Position of an id in its cell
+  std::vector<double> xs_;               ///< Position of every id
+  std::vector<double> ys_;               ///< Position of every id
+  std::vector<std::vector<uint32_t>> members_;  ///< Ids of every cell
+  std::vector<uint8_t> is_touched_;      ///< Whether a cell changed
+  std::vector<uint32_t> touched_;        ///< Cells changed by the batch
+  std::vector<std::pair<uint64_t, const CellSnapshot*>> retired_;
+};
+}  // namespace geometry
+
+#endif  // GEOMETRY__CONCURRENT_GRID_INDEX_HPP_
@@ -0,0 +1,79 @@
+/**
+ * @file geometry/cpu_dispatch.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Run time selection of CPU specific batch kernels
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__CPU_DISPATCH_HPP_
+#define GEOMETRY__CPU_DISPATCH_HPP_
+
+#include <string_view>
+#include <vector>
+
+namespace geometry {
+/**
+ * @brief Instruction set a batch kernel is compiled for. Batch kernels are
+ * ApproximateDistances with a run time approximation, ComputeCurveKeys and
+ * the batch forms of Orient2D and InCircle.
+ */
+enum class KernelPath {
+  kScalar = 0,  ///< The library build flags, the baseline off AArch64
+  kNeon = 1,    ///< AArch64 Advanced SIMD, the baseline on AArch64
+  kAvx2 = 2,    ///< x86-64 AVX2, FMA and BMI2
+  kAvx512 = 3   ///< x86-64 AVX-512 F, VL, DQ and BW on top of kAvx2
+};
+
+/**
+ * @brief Name of the environment variable that forces a kernel path, read
+ * once on first use. Its value is a name from GetKernelPathName; a path this
+ * build or CPU cannot run falls back to the best one.
+ */
+constexpr std::string_view kKernelPathVariable{"GEOMETRY_KERNEL_PATH"};
+
+/**
+ * @brief Get the kernel path batch kernels run on. The first call detects
+ * the CPU features and binds the best available path, or the one forced by
+ * kKernelPathVariable.
+ * @return KernelPath The bound kernel path.
+ */
+[[nodiscard]] auto GetKernelPath() -> KernelPath;
+
+/**
+ * @brief Rebind batch kernels to another path, as for testing every path in
+ * one process.
+ * @param path The kernel path.
+ * @throws std::invalid_argument If the path is not available.
+ */
+auto SetKernelPath(KernelPath path) -> void;
+
+/**
+ * @brief Get the kernel paths that this build contains and this CPU can run.
+ * @return std::vector<KernelPath> The paths, baseline first, best last.
+ */
+[[nodiscard]] auto GetAvailableKernelPaths() -> std::vector<KernelPath>;
+
+/**
+ * @brief Get the name of a kernel path: scalar, neon, avx2 or avx512.
+ * @param path The kernel path.
+ * @return std::string_view The name.
+ * @throws std::invalid_argument If the path is unknown.
+ */
+[[nodiscard]] auto GetKernelPathName(KernelPath path) -> std::string_view;
+
+/**
+ * @brief Parse the name of a kernel path.
+ * @param name The name.
+ * @param path The kernel path, unchanged on failure.
+ * @return bool Whether the name is known.
+ */
+[[nodiscard]] auto ParseKernelPath(std::string_view name, KernelPath& path)
+    -> bool;
+}  // namespace geometry
+
+#endif  // GEOMETRY__CPU_DISPATCH_HPP_
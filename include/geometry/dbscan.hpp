@@ -0,0 +1,60 @@
+/**
+ * @file geometry/dbscan.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Parallel grid-based DBSCAN clustering over Point2D sets
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__DBSCAN_HPP_
+#define GEOMETRY__DBSCAN_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/point2d.hpp"
+
+namespace geometry {
+/**
+ * @brief Options of a DBSCAN run.
+ */
+struct DbscanOptions {
+  Distance eps{1.0};             ///< Neighbourhood radius
+  std::size_t min_points{4};     ///< Neighbours of a core point, itself included
+  std::size_t thread_count{0};   ///< Worker threads, 0 for all hardware threads
+};
+
+/**
+ * @brief Result of a DBSCAN run.
+ */
+struct DbscanResult {
+  /**
+   * @brief Label of a noise point.
+   */
+  static constexpr int32_t kNoise{-1};
+
+  std::vector<int32_t> labels;     ///< Cluster of every input point or kNoise
+  std::vector<uint8_t> is_core;    ///< Whether every input point is a core
+  std::size_t cluster_count{0};    ///< Number of clusters
+};
+
+/**
+ * @brief Cluster points with DBSCAN. Clusters are numbered in order of their
+ * lowest input index, and a border point joins the cluster of its nearest core
+ * point, so the result does not depend on the thread count.
+ * @param points The points to cluster.
+ * @param options The DBSCAN options.
+ * @return DbscanResult The labels of every point.
+ * @throws std::invalid_argument If eps is not positive.
+ */
+[[nodiscard]] auto Dbscan(const std::vector<Point2D>& points,
+                          const DbscanOptions& options) -> DbscanResult;
+}  // namespace geometry
+
+#endif  // GEOMETRY__DBSCAN_HPP_
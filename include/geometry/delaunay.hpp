@@ -0,0 +1,145 @@
+/**
+ * @file geometry/delaunay.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Incremental Delaunay triangulation and dual Voronoi diagram
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__DELAUNAY_HPP_
+#define GEOMETRY__DELAUNAY_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "geometry/point2d.hpp"
+
+namespace geometry {
+/**
+ * @brief Voronoi diagram dual to a Delaunay triangulation.
+ */
+struct VoronoiDiagram {
+  std::vector<Point2D> vertices;       ///< Circumcenter of every triangle
+  std::vector<uint32_t> cell_offsets;  ///< Cell of site i is [i], [i + 1]
+  std::vector<uint32_t> cell_vertices;  ///< Counter-clockwise vertex indices
+  std::vector<uint8_t> is_unbounded;    ///< Whether the cell of a site is open
+};
+
+/**
+ * @brief Delaunay triangulation of a point set, stored as flat half-edge
+ * arrays. Half-edge e belongs to triangle e / 3, starts at vertex
+ * GetTriangles()[e] and its twin is GetHalfEdges()[e]. Triangles are
+ * counter-clockwise. Duplicate points are inserted once, their later copies
+ * belong to no triangle.
+ */
+class DelaunayTriangulation {
+ public:
+  /**
+   * @brief Twin of a half-edge on the convex hull.
+   */
+  static constexpr uint32_t kInvalidIndex{std::numeric_limits<uint32_t>::max()};
+
+  /**
+   * @brief Construct an empty DelaunayTriangulation object.
+   */
+  DelaunayTriangulation() = default;
+
+  /**
+   * @brief Triangulate points, inserting them in biased randomized insertion
+   * order with Hilbert curve order inside every round.
+   * @param points The points.
+   * @throws std::invalid_argument If a coordinate is not finite or there are
+   * more than 2^30 points.
+   */
+  explicit DelaunayTriangulation(const std::vector<Point2D>& points);
+
+  /**
+   * @brief Get the triangulated points.
+   * @return const std::vector<Point2D>& The points.
+   */
+  [[nodiscard]] auto GetPoints() const -> const std::vector<Point2D>& {
+    return points_;
+  }
+
+  /**
+   * @brief Get the start vertex of every half-edge, three per triangle.
+   * @return const std::vector<uint32_t>& The vertex indices.
+   */
+  [[nodiscard]] auto GetTriangles() const -> const std::vector<uint32_t>& {
+    return triangles_;
+  }
+
+  /**
+   * @brief Get the twin of every half-edge, kInvalidIndex on the hull.
+   * @return const std::vector<uint32_t>& The twin half-edges.
+   */
+  [[nodiscard]] auto GetHalfEdges() const -> const std::vector<uint32_t>& {
+    return half_edges_;
+  }
+
+  /**
+   * @brief Get the number of triangles.
+   * @return std::size_t The number of triangles.
+   */
+  [[nodiscard]] auto GetTriangleCount() const -> std::size_t {
+    return triangles_.size() / 3;
+  }
+
+  /**
+   * @brief Get the convex hull vertices in counter-clockwise order.
+   * @return const std::vector<uint32_t>& The hull vertex indices.
+   */
+  [[nodiscard]] auto GetHull() const -> const std::vector<uint32_t>& {
+    return hull_;
+  }
+
+  /**
+   * @brief Get the vertices adjacent to a vertex in counter-clockwise order.
+   * @param vertex The vertex index.
+   * @return std::vector<uint32_t> The neighbour indices, empty if the vertex
+   * is a duplicate or not part of any triangle.
+   */
+  [[nodiscard]] auto GetNeighbours(uint32_t vertex) const
+      -> std::vector<uint32_t>;
+
+  /**
+   * @brief Extract the dual Voronoi diagram.
+   * @return VoronoiDiagram The Voronoi diagram.
+   */
+  [[nodiscard]] auto ComputeVoronoi() const -> VoronoiDiagram;
+
+  /**
+   * @brief Compute the Voronoi cell of a site clipped to an axis-aligned box.
+   * @param vertex The site index.
+   * @param min_corner The lower left corner of the box.
+   * @param max_corner The upper right corner of the box.
+   * @return std::vector<Point2D> The counter-clockwise cell polygon, empty if
+   * the cell misses the box or the site is not part of any triangle.
+   */
+  [[nodiscard]] auto ClipVoronoiCell(uint32_t vertex, const Point2D& min_corner,
+                                     const Point2D& max_corner) const
+      -> std::vector<Point2D>;
+
+ protected:
+ private:
+  /**
+   * @brief Walk the triangles around a vertex clockwise.
+   */
+  template <typename Visitor>
+  auto ForEachIncoming(uint32_t vertex, Visitor&& visitor) const -> bool;
+
+  std::vector<Point2D> points_;        ///< Input points
+  std::vector<uint32_t> triangles_;    ///< Start vertex of every half-edge
+  std::vector<uint32_t> half_edges_;   ///< Twin of every half-edge
+  std::vector<uint32_t> hull_;         ///< Counter-clockwise hull vertices
+  std::vector<uint32_t> incoming_;     ///< A half-edge ending at every vertex
+};
+}  // namespace geometry
+
+#endif  // GEOMETRY__DELAUNAY_HPP_
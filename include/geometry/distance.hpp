@@ -84,6 +84,20 @@ class Distance {
    */
   auto SetValue(double input_value, const Type& input_type) -> void;
 
+  /**
+   * @brief Get the exact Distance value in nanometers.
+   * @return int64_t The nanometers.
+   */
+  [[nodiscard]] auto GetNanometer() const -> int64_t;
+
+  /**
+   * @brief Make a Distance from an exact nanometer count, without the
+   * rounding of the double constructor beyond 2^53 nanometers.
+   * @param nanometer The nanometers.
+   * @return Distance The distance.
+   */
+  [[nodiscard]] static auto FromNanometer(int64_t nanometer) -> Distance;
+
   /**
    * @brief Compare with other distance object for equality.
    * @param other The other distance object.
@@ -202,4 +216,7 @@ class Distance {
 
 }  // namespace geometry
 
+#if defined(GEOMETRY_INLINE_HOT_PATH)
+#include "geometry/distance_inline.hpp"
+#endif
 #endif  // GEOMETRY__Distance_HPP_
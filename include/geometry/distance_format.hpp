@@ -0,0 +1,87 @@
+/**
+ * @file geometry/distance_format.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Allocation-free parsing and formatting of Distance strings
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__DISTANCE_FORMAT_HPP_
+#define GEOMETRY__DISTANCE_FORMAT_HPP_
+
+#include <charconv>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include "geometry/distance.hpp"
+
+namespace geometry {
+/**
+ * @brief Parse a distance like "12.5km", "300 m" or "-0.2mm" in the manner
+ * of std::from_chars. The number is an optional sign, decimal digits with an
+ * optional fraction and an optional exponent. It may be followed by spaces
+ * and one of the unit suffixes "km", "m", "cm", "mm", "um" (or "µm") and
+ * "nm"; a number without a suffix is in meters. Plain decimals are converted
+ * exactly and rounded half away from zero to the nanometer; numbers with an
+ * exponent go through a double.
+ * @param first The first character.
+ * @param last One past the last character.
+ * @param distance The parsed distance, untouched on error.
+ * @return std::from_chars_result One past the last character parsed and
+ * std::errc{}, or first and std::errc::invalid_argument if no distance
+ * starts at first, or std::errc::result_out_of_range if it does not fit 64
+ * bits of nanometers.
+ */
+auto ParseDistance(const char* first, const char* last, Distance& distance)
+    -> std::from_chars_result;
+
+/**
+ * @brief Format a distance in the given unit with its suffix, like "12.5km",
+ * in the manner of std::to_chars. The value is written exactly, with the
+ * trailing zeros of the fraction dropped, so parsing it gives the same
+ * nanometers back.
+ * @param first The first character of the buffer.
+ * @param last One past the last character of the buffer.
+ * @param distance The distance.
+ * @param unit The unit.
+ * @return std::to_chars_result One past the last character written and
+ * std::errc{}, or last and std::errc::value_too_large if the buffer is too
+ * small.
+ */
+auto FormatDistance(char* first, char* last, const Distance& distance,
+                    Distance::Type unit = Distance::Type::kMeter)
+    -> std::to_chars_result;
+
+/**
+ * @brief Parse a column of distance strings. Each string must be a whole
+ * distance as accepted by ParseDistance.
+ * @param texts The first string.
+ * @param count The number of strings.
+ * @param distances The parsed distances, count of them.
+ * @return std::size_t The index of the first string that is not a distance,
+ * or count if all were parsed.
+ */
+auto ParseDistances(const std::string_view* texts, std::size_t count,
+                    Distance* distances) -> std::size_t;
+
+/**
+ * @brief Parse a column of distance strings. Each string must be a whole
+ * distance as accepted by ParseDistance.
+ * @param texts The strings.
+ * @param distances The parsed distances, resized to the number of strings.
+ * @return std::size_t The index of the first string that is not a distance,
+ * or the number of strings if all were parsed.
+ */
+inline auto ParseDistances(const std::vector<std::string_view>& texts,
+                           std::vector<Distance>& distances) -> std::size_t {
+  distances.resize(texts.size());
+  return ParseDistances(texts.data(), texts.size(), distances.data());
+}
+}  // namespace geometry
+
+#endif  // GEOMETRY__DISTANCE_FORMAT_HPP_
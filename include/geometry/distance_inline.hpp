@@ -0,0 +1,62 @@
+/**
+ * @file geometry/distance_inline.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Trivial Distance members, see hot_path.hpp
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__DISTANCE_INLINE_HPP_
+#define GEOMETRY__DISTANCE_INLINE_HPP_
+
+#include "geometry/distance.hpp"
+#include "geometry/hot_path.hpp"
+
+namespace geometry {
+GEOMETRY_HOT_PATH auto Distance::GetNanometer() const -> int64_t {
+  return nanometer_;
+}
+
+GEOMETRY_HOT_PATH auto Distance::FromNanometer(int64_t nanometer)
+    -> Distance {
+  Distance distance;
+  distance.nanometer_ = nanometer;
+  return distance;
+}
+
+GEOMETRY_HOT_PATH auto Distance::operator==(const Distance& other) const
+    -> bool {
+  return (nanometer_ == other.nanometer_);
+}
+
+GEOMETRY_HOT_PATH auto Distance::operator!=(const Distance& other) const
+    -> bool {
+  return (nanometer_ != other.nanometer_);
+}
+
+GEOMETRY_HOT_PATH auto Distance::operator<(const Distance& other) const
+    -> bool {
+  return (nanometer_ < other.nanometer_);
+}
+
+GEOMETRY_HOT_PATH auto Distance::operator<=(const Distance& other) const
+    -> bool {
+  return (nanometer_ <= other.nanometer_);
+}
+
+GEOMETRY_HOT_PATH auto Distance::operator>(const Distance& other) const
+    -> bool {
+  return (nanometer_ > other.nanometer_);
+}
+
+GEOMETRY_HOT_PATH auto Distance::operator>=(const Distance& other) const
+    -> bool {
+  return (nanometer_ >= other.nanometer_);
+}
+}  // namespace geometry
+
+#endif  // GEOMETRY__DISTANCE_INLINE_HPP_
@@ -0,0 +1,126 @@
+/**
+ * @file geometry/distance_sort.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Radix sorting, top-k selection and histograms of Distance arrays
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__DISTANCE_SORT_HPP_
+#define GEOMETRY__DISTANCE_SORT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/distance.hpp"
+
+namespace geometry {
+/**
+ * @brief Counts of distances in bins of equal width. Bin i holds the
+ * distances d with origin + i * bin_width <= d < origin + (i + 1) * bin_width.
+ */
+struct DistanceHistogram {
+  Distance origin;               ///< Lower bound of the first bin
+  Distance bin_width;            ///< Width of every bin
+  std::vector<uint64_t> counts;  ///< Distances per bin
+  uint64_t underflow{0};         ///< Distances below the first bin
+  uint64_t overflow{0};          ///< Distances above the last bin
+};
+
+/**
+ * @brief Stable parallel LSD radix sort of count distances on their
+ * nanometers, moving indices along if it is not null.
+ * @param distances The distances, sorted in place.
+ * @param indices The values that follow the distances, or nullptr.
+ * @param count The number of distances.
+ * @param thread_count The number of worker threads, 0 for all hardware
+ * threads.
+ */
+auto SortDistances(Distance* distances, uint32_t* indices, std::size_t count,
+                   std::size_t thread_count = 0) -> void;
+
+/**
+ * @brief Stable parallel LSD radix sort of distances.
+ * @param distances The distances, sorted in place.
+ * @param thread_count The number of worker threads, 0 for all hardware
+ * threads.
+ */
+auto SortDistances(std::vector<Distance>& distances,
+                   std::size_t thread_count = 0) -> void;
+
+/**
+ * @brief Order of distances from a stable parallel LSD radix sort.
+ * @param distances The distances.
+ * @param thread_count The number of worker threads, 0 for all hardware
+ * threads.
+ * @return std::vector<uint32_t> The index of each distance in ascending
+ * order, equal distances in input order.
+ * @throws std::invalid_argument If there are 2^32 distances or more.
+ */
+[[nodiscard]] auto ArgsortDistances(const std::vector<Distance>& distances,
+                                    std::size_t thread_count = 0)
+    -> std::vector<uint32_t>;
+
+/**
+ * @brief Indices of the k smallest distances in ascending order, equal
+ * distances in input order. A radix select narrows the candidates one byte at
+ * a time, so the cost is linear in the number of distances.
+ * @param distances The distances.
+ * @param k The number of distances to select, all of them if it is larger.
+ * @return std::vector<uint32_t> The indices of the min(k, size) smallest
+ * distances.
+ * @throws std::invalid_argument If there are 2^32 distances or more.
+ */
+[[nodiscard]] auto SelectSmallestDistances(
+    const std::vector<Distance>& distances, std::size_t k)
+    -> std::vector<uint32_t>;
+
+/**
+ * @brief Count distances into bin_count bins of equal width. Bin indices of a
+ * block are computed in one branch-free pass over the nanometers before they
+ * are counted.
+ * @param distances The first distance.
+ * @param count The number of distances.
+ * @param origin The lower bound of the first bin.
+ * @param bin_width The width of every bin.
+ * @param bin_count The number of bins.
+ * @param thread_count The number of worker threads, 0 for all hardware
+ * threads.
+ * @return DistanceHistogram The histogram.
+ * @throws std::invalid_argument If the bin width is not positive, there are
+ * no bins or the bins span more than the nanometer range.
+ */
+[[nodiscard]] auto HistogramDistances(const Distance* distances,
+                                      std::size_t count,
+                                      const Distance& origin,
+                                      const Distance& bin_width,
+                                      std::size_t bin_count,
+                                      std::size_t thread_count = 0)
+    -> DistanceHistogram;
+
+/**
+ * @brief Count distances into bin_count bins of equal width.
+ * @param distances The distances.
+ * @param origin The lower bound of the first bin.
+ * @param bin_width The width of every bin.
+ * @param bin_count The number of bins.
+ * @param thread_count The number of worker threads, 0 for all hardware
+ * threads.
+ * @return DistanceHistogram The histogram.
+ * @throws std::invalid_argument If the bin width is not positive, there are
+ * no bins or the bins span more than the nanometer range.
+ */
+[[nodiscard]] auto HistogramDistances(const std::vector<Distance>& distances,
+                                      const Distance& origin,
+                                      const Distance& bin_width,
+                                      std::size_t bin_count,
+                                      std::size_t thread_count = 0)
+    -> DistanceHistogram;
+}  // namespace geometry
+
+#endif  // GEOMETRY__DISTANCE_SORT_HPP_
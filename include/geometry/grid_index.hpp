@@ -0,0 +1,215 @@
+/**
+ * @file geometry/grid_index.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Uniform grid spatial partition over Point2D sets
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__GRID_INDEX_HPP_
+#define GEOMETRY__GRID_INDEX_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/point2d.hpp"
+
+namespace geometry {
+/**
+ * @brief Uniform grid over a point set, stored cell by cell in compressed
+ * rows with structure-of-arrays coordinates. Point2D coordinates are
+ * interpreted in meters, the default unit of Distance.
+ */
+class GridIndex {
+ public:
+  /**
+   * @brief Construct an empty GridIndex object.
+   */
+  GridIndex() = default;
+
+  /**
+   * @brief Construct a new GridIndex object over points.
+   * @param points The points to index.
+   * @param cell_size The cell edge length, zero to pick one automatically.
+   * @throws std::invalid_argument If a coordinate is not finite, the extent
+   * of the points overflows, the cell size is negative or there are more than
+   * 2^32 - 1 points.
+   */
+  explicit GridIndex(const std::vector<Point2D>& points,
+                     const Distance& cell_size = Distance());
+
+  /**
+   * @brief Rebuild the index over points.
+   * @param points The points to index.
+   * @param cell_size The cell edge length, zero to pick one automatically.
+   * @throws std::invalid_argument If a coordinate is not finite, the extent
+   * of the points overflows, the cell size is negative or there are more than
+   * 2^32 - 1 points.
+   */
+  auto Build(const std::vector<Point2D>& points,
+             const Distance& cell_size = Distance()) -> void;
+
+  /**
+   * @brief Get the number of indexed points.
+   * @return std::size_t The number of points.
+   */
+  [[nodiscard]] auto GetSize() const -> std::size_t { return xs_.size(); }
+
+  /**
+   * @brief Get the cell edge length in meters.
+   * @return double The cell edge length.
+   */
+  [[nodiscard]] auto GetCellSize() const -> double { return cell_size_; }
+
+  /**
+   * @brief Get the number of cell columns.
+   * @return std::size_t The number of columns.
+   */
+  [[nodiscard]] auto GetColumnCount() const -> std::size_t { return columns_; }
+
+  /**
+   * @brief Get the number of cell rows.
+   * @return std::size_t The number of rows.
+   */
+  [[nodiscard]] auto GetRowCount() const -> std::size_t { return rows_; }
+
+  /**
+   * @brief Get the lower x bound of the grid.
+   * @return double The lower x bound.
+   */
+  [[nodiscard]] auto GetMinX() const -> double { return min_x_; }
+
+  /**
+   * @brief Get the lower y bound of the grid.
+   * @return double The lower y bound.
+   */
+  [[nodiscard]] auto GetMinY() const -> double { return min_y_; }
+
+  /**
+   * @brief Get the column holding x, clamped to the grid.
+   * @param x The x coordinate.
+   * @return std::size_t The column.
+   */
+  [[nodiscard]] auto GetColumn(double x) const -> std::size_t {
+    return Clamp((x - min_x_) * inverse_cell_size_, columns_);
+  }
+
+  /**
+   * @brief Get the row holding y, clamped to the grid.
+   * @param y The y coordinate.
+   * @return std::size_t The row.
+   */
+  [[nodiscard]] auto GetRow(double y) const -> std::size_t {
+    return Clamp((y - min_y_) * inverse_cell_size_, rows_);
+  }
+
+  /**
+   * @brief Get the first slot of a cell.
+   * @param column The column.
+   * @param row The row.
+   * @return std::size_t The first slot.
+   */
+  [[nodiscard]] auto GetCellBegin(std::size_t column, std::size_t row) const
+      -> std::size_t {
+    return cell_begin_[(row * columns_) + column];
+  }
+
+  /**
+   * @brief Get the slot past the end of a cell.
+   * @param column The column.
+   * @param row The row.
+   * @return std::size_t The slot past the end.
+   */
+  [[nodiscard]] auto GetCellEnd(std::size_t column, std::size_t row) const
+      -> std::size_t {
+    return cell_begin_[(row * columns_) + column + 1];
+  }
+
+  /**
+   * @brief Get the x coordinates in slot order.
+   * @return const std::vector<double>& The x coordinates.
+   */
+  [[nodiscard]] auto GetXs() const -> const std::vector<double>& {
+    return xs_;
+  }
+
+  /**
+   * @brief Get the y coordinates in slot order.
+   * @return const std::vector<double>& The y coordinates.
+   */
+  [[nodiscard]] auto GetYs() const -> const std::vector<double>& {
+    return ys_;
+  }
+
+  /**
+   * @brief Get the input indices in slot order.
+   * @return const std::vector<uint32_t>& The input indices.
+   */
+  [[nodiscard]] auto GetIndices() const -> const std::vector<uint32_t>& {
+    return indices_;
+  }
+
+  /**
+   * @brief Visit every point within radius of center.
+   * @param center The query point.
+   * @param radius The query radius.
+   * @param visitor Called as visitor(input_index, squared_distance).
+   */
+  template <typename Visitor>
+  auto ForEachInRadius(const Point2D& center, const Distance& radius,
+                       Visitor&& visitor) const -> void {
+    if (xs_.empty()) {
+      return;
+    }
+    const double range{radius.GetValue(Distance::Type::kMeter)};
+    const double squared_range{range * range};
+    const double x{center.GetX()};
+    const double y{center.GetY()};
+    const std::size_t first_column{GetColumn(x - range)};
+    const std::size_t last_column{GetColumn(x + range)};
+    const std::size_t first_row{GetRow(y - range)};
+    const std::size_t last_row{GetRow(y + range)};
+    for (std::size_t row = first_row; row <= last_row; ++row) {
+      const std::size_t end{GetCellEnd(last_column, row)};
+      for (std::size_t slot = GetCellBegin(first_column, row); slot < end;
+           ++slot) {
+        const double dx{xs_[slot] - x};
+        const double dy{ys_[slot] - y};
+        const double squared{(dx * dx) + (dy * dy)};
+        if (squared <= squared_range) {
+          visitor(indices_[slot], squared);
+        }
+      }
+    }
+  }
+
+ protected:
+ private:
+  static auto Clamp(double cell, std::size_t count) -> std::size_t {
+    if (!(cell > 0.0)) {
+      return 0;
+    }
+    return std::min(static_cast<std::size_t>(cell), count - 1);
+  }
+
+  double min_x_{0.0};                ///< Lower x bound
+  double min_y_{0.0};                ///< Lower y bound
+  double cell_size_{1.0};            ///< Cell edge length
+  double inverse_cell_size_{1.0};    ///< Reciprocal of the cell edge length
+  std::size_t columns_{1};           ///< Number of columns
+  std::size_t rows_{1};              ///< Number of rows
+  std::vector<uint32_t> cell_begin_{0, 0};  ///< Row-major cell offsets
+  std::vector<double> xs_;           ///< x coordinates in slot order
+  std::vector<double> ys_;           ///< y coordinates in slot order
+  std::vector<uint32_t> indices_;    ///< Input indices in slot order
+};
+}  // namespace geometry
+
+#endif  // GEOMETRY__GRID_INDEX_HPP_
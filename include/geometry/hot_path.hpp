@@ -0,0 +1,29 @@
+/**
+ * @file geometry/hot_path.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Linkage of the trivial hot-path members
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__HOT_PATH_HPP_
+#define GEOMETRY__HOT_PATH_HPP_
+
+// The trivial members of Point2D and Distance are written once, in
+// point2d_inline.hpp and distance_inline.hpp. With GEOMETRY_INLINE_HOT_PATH
+// the class headers include them as inline definitions, so that callers can
+// inline and vectorise them without link-time optimization; otherwise the
+// library sources include them as ordinary out-of-line definitions. Every
+// translation unit of a program must agree on the macro, which the CMake
+// targets take care of.
+#if defined(GEOMETRY_INLINE_HOT_PATH)
+#define GEOMETRY_HOT_PATH inline
+#else
+#define GEOMETRY_HOT_PATH
+#endif
+
+#endif  // GEOMETRY__HOT_PATH_HPP_
@@ -0,0 +1,194 @@
+/**
+ * @file geometry/instrumentation.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Compile-time toggleable counters and latency histograms
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__INSTRUMENTATION_HPP_
+#define GEOMETRY__INSTRUMENTATION_HPP_
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace geometry {
+namespace instrumentation {
+
+/**
+ * @brief Whether the library was built with GEOMETRY_ENABLE_INSTRUMENTATION.
+ */
+#ifdef GEOMETRY_ENABLE_INSTRUMENTATION
+constexpr bool kEnabled{true};
+#else
+constexpr bool kEnabled{false};
+#endif
+
+/**
+ * @brief The enum class for instrumented library entry points and paths.
+ */
+enum class Probe {
+  kPointCalculateDistance = 0,      ///< Point2D::CalculateDistance
+  kPointDivisionByZero = 1,         ///< Point2D::operator/ returning NaN
+  kDistanceToNanometer = 2,         ///< Unit conversion into Distance
+  kDistanceFromNanometer = 3,       ///< Unit conversion out of Distance
+  kDistanceDivisionByZero = 4,      ///< Distance::operator/ throwing
+  kKnnJoin = 5,                     ///< KnnJoin batch call
+  kDbscan = 6,                      ///< Dbscan batch call
+  kKMeans = 7,                      ///< KMeans and MiniBatchKMeans batch calls
+  kPolylineDistance = 8,            ///< Hausdorff and Frechet distance calls
+  kDelaunay = 9,                    ///< Delaunay and Voronoi construction
+  kConcurrentGridIndexUpdate = 10,  ///< ConcurrentGridIndex write batches
+  kCount = 11                       ///< Number of probes
+};
+
+/**
+ * @brief Number of probes.
+ */
+constexpr std::size_t kProbeCount{static_cast<std::size_t>(Probe::kCount)};
+
+/**
+ * @brief Number of log2 latency buckets. Bucket i holds samples in
+ * [2^(i-1), 2^i) nanoseconds, bucket 0 holds zero-length samples.
+ */
+constexpr std::size_t kHistogramBucketCount{64U};
+
+/**
+ * @brief Get the stable name of a probe.
+ * @param probe The probe.
+ * @return const char* The probe name, e.g. "point2d.calculate_distance".
+ */
+[[nodiscard]] auto GetProbeName(Probe probe) -> const char*;
+
+/**
+ * @brief Aggregated values of a single probe.
+ */
+struct ProbeSnapshot {
+  uint64_t count{0};     ///< Number of hits
+  uint64_t samples{0};   ///< Number of timed hits
+  uint64_t total_ns{0};  ///< Sum of timed latencies in nanoseconds
+  std::array<uint64_t, kHistogramBucketCount> buckets{};  ///< Histogram
+
+  /**
+   * @brief Estimate a latency quantile from the histogram.
+   * @param quantile The quantile in [0, 1].
+   * @return uint64_t Upper bound of the bucket holding the quantile in
+   * nanoseconds, or 0 if there are no samples.
+   */
+  [[nodiscard]] auto GetQuantile(double quantile) const -> uint64_t;
+};
+
+/**
+ * @brief Aggregated values of every probe over every thread.
+ */
+struct Snapshot {
+  std::array<ProbeSnapshot, kProbeCount> probes{};  ///< Per probe values
+
+  /**
+   * @brief Get the values of a probe.
+   * @param probe The probe.
+   * @return const ProbeSnapshot& The values of the probe.
+   */
+  [[nodiscard]] auto Get(Probe probe) const -> const ProbeSnapshot&;
+
+  /**
+   * @brief Dump as human readable text, one probe per line.
+   * @return std::string The text dump.
+   */
+  [[nodiscard]] auto ToText() const -> std::string;
+
+  /**
+   * @brief Dump as a JSON object keyed by probe name.
+   * @return std::string The JSON dump.
+   */
+  [[nodiscard]] auto ToJson() const -> std::string;
+};
+
+/**
+ * @brief Collect the counters of all live and finished threads.
+ * @return Snapshot The aggregated values. All zero if instrumentation is
+ * compiled out.
+ */
+[[nodiscard]] auto TakeSnapshot() -> Snapshot;
+
+/**
+ * @brief Reset the counters of all live and finished threads. Concurrent
+ * updates may survive the reset.
+ */
+auto Reset() -> void;
+
+/**
+ * @brief Enable or disable writing begin/end markers of timed probes to the
+ * ftrace marker file, so `perf record -e ftrace:print` can correlate them.
+ * @param enable Whether to emit markers.
+ * @return true If markers are emitted after the call.
+ * @return false If markers are unavailable on this system or build.
+ */
+auto EnablePerfMarkers(bool enable) -> bool;
+
+/**
+ * @brief Increment the counter of a probe on the calling thread.
+ * @param probe The probe.
+ */
+auto Count(Probe probe) -> void;
+
+/**
+ * @brief Record a timed hit of a probe on the calling thread.
+ * @param probe The probe.
+ * @param nanoseconds The latency in nanoseconds.
+ */
+auto Record(Probe probe, uint64_t nanoseconds) -> void;
+
+/**
+ * @brief RAII timer recording the lifetime of the scope into a probe.
+ */
+class ScopedTimer {
+ public:
+  /**
+   * @brief Start timing.
+   * @param probe The probe to record into.
+   */
+  explicit ScopedTimer(Probe probe);
+
+  ScopedTimer(const ScopedTimer& other) = delete;
+  ScopedTimer(ScopedTimer&& other) = delete;
+  auto operator=(const ScopedTimer& other) -> ScopedTimer& = delete;
+  auto operator=(ScopedTimer&& other) -> ScopedTimer& = delete;
+
+  /**
+   * @brief Stop timing and record the latency.
+   */
+  ~ScopedTimer();
+
+ private:
+  Probe probe_;                                  ///< Probe to record into
+  std::chrono::steady_clock::time_point start_;  ///< Start time
+};
+
+}  // namespace instrumentation
+}  // namespace geometry
+
+#define GEOMETRY_INSTRUMENTATION_CONCAT_IMPL(lhs, rhs) lhs##rhs
+#define GEOMETRY_INSTRUMENTATION_CONCAT(lhs, rhs) \
+  GEOMETRY_INSTRUMENTATION_CONCAT_IMPL(lhs, rhs)
+
+#ifdef GEOMETRY_ENABLE_INSTRUMENTATION
+#define GEOMETRY_INSTRUMENT_COUNT(probe) \
+  ::geometry::instrumentation::Count(::geometry::instrumentation::Probe::probe)
+#define GEOMETRY_INSTRUMENT_SCOPE(probe)                                    \
+  const ::geometry::instrumentation::ScopedTimer                            \
+      GEOMETRY_INSTRUMENTATION_CONCAT(geometry_instrumentation_, __LINE__)( \
+          ::geometry::instrumentation::Probe::probe)
+#else
+#define GEOMETRY_INSTRUMENT_COUNT(probe) static_cast<void>(0)
+#define GEOMETRY_INSTRUMENT_SCOPE(probe) static_cast<void>(0)
+#endif
+
+#endif  // GEOMETRY__INSTRUMENTATION_HPP_
@@ -0,0 +1,119 @@
+/**
+ * @file geometry/kmeans.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief k-means clustering with bound pruning and mini-batch updates
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__KMEANS_HPP_
+#define GEOMETRY__KMEANS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/point2d.hpp"
+
+namespace geometry {
+/**
+ * @brief Options of a k-means run.
+ */
+struct KMeansOptions {
+  std::size_t k{8};                 ///< Number of clusters
+  std::size_t max_iterations{100};  ///< Upper bound of Lloyd iterations
+  Distance tolerance{};  ///< Stop when no centroid moves further than this
+  uint64_t seed{0};      ///< Seed of the k-means++ sampling
+  std::size_t thread_count{0};  ///< Worker threads, 0 for all hardware threads
+};
+
+/**
+ * @brief Result of a k-means run.
+ */
+struct KMeansResult {
+  std::vector<Point2D> centroids;     ///< Cluster centroids
+  std::vector<uint32_t> labels;       ///< Centroid of every input point
+  double inertia{0.0};  ///< Sum of squared distances to the centroids in m^2
+  std::size_t iterations{0};          ///< Number of Lloyd iterations run
+  uint64_t distance_evaluations{0};   ///< Point to centroid distances computed
+};
+
+/**
+ * @brief Cluster points with k-means++ seeding and Lloyd iterations, pruned
+ * with Hamerly's upper and lower distance bounds. For a fixed seed and thread
+ * count the result is deterministic.
+ * @param points The points to cluster.
+ * @param options The k-means options.
+ * @return KMeansResult The centroids and labels.
+ * @throws std::invalid_argument If k is zero or larger than the number of
+ * points.
+ */
+[[nodiscard]] auto KMeans(const std::vector<Point2D>& points,
+                          const KMeansOptions& options) -> KMeansResult;
+
+/**
+ * @brief Streaming k-means updating the centroids one mini-batch at a time
+ * with per-centroid learning rates.
+ */
+class MiniBatchKMeans {
+ public:
+  /**
+   * @brief Construct a new MiniBatchKMeans object. The centroids are seeded
+   * with k-means++ from the first batch.
+   * @param options The k-means options, max_iterations and tolerance unused.
+   * @throws std::invalid_argument If k is zero.
+   */
+  explicit MiniBatchKMeans(const KMeansOptions& options);
+
+  /**
+   * @brief Fold a batch of points into the centroids.
+   * @param points The first point of the batch.
+   * @param count The number of points in the batch.
+   * @throws std::invalid_argument If the first batch has fewer than k points.
+   */
+  auto Update(const Point2D* points, std::size_t count) -> void;
+
+  /**
+   * @brief Fold a batch of points into the centroids.
+   * @param points The batch.
+   * @throws std::invalid_argument If the first batch has fewer than k points.
+   */
+  auto Update(const std::vector<Point2D>& points) -> void;
+
+  /**
+   * @brief Find the nearest centroid of a point.
+   * @param point The point.
+   * @return uint32_t The index of the nearest centroid.
+   * @throws std::logic_error If no batch was folded in yet.
+   */
+  [[nodiscard]] auto Predict(const Point2D& point) const -> uint32_t;
+
+  /**
+   * @brief Get the centroids, empty before the first batch.
+   * @return std::vector<Point2D> The centroids.
+   */
+  [[nodiscard]] auto GetCentroids() const -> std::vector<Point2D>;
+
+  /**
+   * @brief Get the number of points folded into every centroid.
+   * @return const std::vector<uint64_t>& The counts.
+   */
+  [[nodiscard]] auto GetCounts() const -> const std::vector<uint64_t>& {
+    return counts_;
+  }
+
+ protected:
+ private:
+  KMeansOptions options_;         ///< Options
+  std::vector<double> xs_;        ///< Centroid x coordinates
+  std::vector<double> ys_;        ///< Centroid y coordinates
+  std::vector<uint64_t> counts_;  ///< Points folded into every centroid
+};
+}  // namespace geometry
+
+#endif  // GEOMETRY__KMEANS_HPP_
@@ -0,0 +1,79 @@
+/**
+ * @file geometry/knn_join.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Batch k-nearest-neighbour join between two Point2D sets
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__KNN_JOIN_HPP_
+#define GEOMETRY__KNN_JOIN_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/grid_index.hpp"
+#include "geometry/point2d.hpp"
+
+namespace geometry {
+/**
+ * @brief Options of a kNN join.
+ */
+struct KnnJoinOptions {
+  std::size_t k{1};              ///< Neighbours per query
+  std::size_t thread_count{0};   ///< Worker threads, 0 for all hardware threads
+  std::size_t batch_size{1024};  ///< Spatially sorted queries per work item
+};
+
+/**
+ * @brief Result of a kNN join, stored row-major with k entries per query and
+ * neighbours sorted by ascending distance. Missing neighbours, when the
+ * reference set has fewer than k points, have index kInvalidIndex.
+ */
+struct KnnJoinResult {
+  /**
+   * @brief Index of a missing neighbour.
+   */
+  static constexpr uint32_t kInvalidIndex{std::numeric_limits<uint32_t>::max()};
+
+  std::size_t k{0};                ///< Neighbours per query
+  std::vector<uint32_t> indices;   ///< Reference indices, query * k + rank
+  std::vector<Distance> distances; ///< Distances, query * k + rank
+};
+
+/**
+ * @brief Find the k nearest reference points of every query point.
+ * @param queries The query points.
+ * @param references The reference points, indexed by a fresh GridIndex.
+ * @param options The join options.
+ * @return KnnJoinResult The neighbours of every query.
+ * @throws std::invalid_argument If k is zero.
+ */
+[[nodiscard]] auto KnnJoin(const std::vector<Point2D>& queries,
+                           const std::vector<Point2D>& references,
+                           const KnnJoinOptions& options = KnnJoinOptions())
+    -> KnnJoinResult;
+
+/**
+ * @brief Find the k nearest reference points of every query point, reusing
+ * an index built over the reference points.
+ * @param queries The query points.
+ * @param references The index over the reference points.
+ * @param options The join options.
+ * @return KnnJoinResult The neighbours of every query.
+ * @throws std::invalid_argument If k is zero.
+ */
+[[nodiscard]] auto KnnJoin(const std::vector<Point2D>& queries,
+                           const GridIndex& references,
+                           const KnnJoinOptions& options = KnnJoinOptions())
+    -> KnnJoinResult;
+}  // namespace geometry
+
+#endif  // GEOMETRY__KNN_JOIN_HPP_
@@ -159,4 +159,8 @@ private:
   double y_{0.0}; ///< y coordinate
 };
 } // namespace geometry
+
+#if defined(GEOMETRY_INLINE_HOT_PATH)
+#include "geometry/point2d_inline.hpp"
+#endif
 #endif // GEOMETRY__POINT_2D_HPP_
@@ -0,0 +1,82 @@
+/**
+ * @file geometry/point2d_inline.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Trivial Point2D members, see hot_path.hpp
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__POINT_2D_INLINE_HPP_
+#define GEOMETRY__POINT_2D_INLINE_HPP_
+
+#include <limits>
+
+#include "geometry/hot_path.hpp"
+#include "geometry/instrumentation.hpp"
+#include "geometry/point2d.hpp"
+
+namespace geometry {
+GEOMETRY_HOT_PATH Point2D::Point2D(double input_x, double input_y)
+    : x_(input_x), y_(input_y) {}
+
+GEOMETRY_HOT_PATH auto Point2D::GetX() const -> double { return x_; }
+
+GEOMETRY_HOT_PATH auto Point2D::GetY() const -> double { return y_; }
+
+GEOMETRY_HOT_PATH auto Point2D::SetX(double input_x) -> void { x_ = input_x; }
+
+GEOMETRY_HOT_PATH auto Point2D::SetY(double input_y) -> void { y_ = input_y; }
+
+GEOMETRY_HOT_PATH auto Point2D::operator+(const Point2D& other) const
+    -> Point2D {
+  return {x_ + other.x_, y_ + other.y_};
+}
+
+GEOMETRY_HOT_PATH auto Point2D::operator-(const Point2D& other) const
+    -> Point2D {
+  return {x_ - other.x_, y_ - other.y_};
+}
+
+GEOMETRY_HOT_PATH auto Point2D::operator+=(const Point2D& other)
+    -> Point2D& {
+  x_ += other.x_;
+  y_ += other.y_;
+  return *this;
+}
+
+GEOMETRY_HOT_PATH auto Point2D::operator-=(const Point2D& other)
+    -> Point2D& {
+  x_ -= other.x_;
+  y_ -= other.y_;
+  return *this;
+}
+
+GEOMETRY_HOT_PATH auto Point2D::operator*(double scalar) const -> Point2D {
+  return {x_ * scalar, y_ * scalar};
+}
+
+GEOMETRY_HOT_PATH auto Point2D::operator/(double scalar) const -> Point2D {
+  if (scalar != 0.0) {
+    return {x_ / scalar, y_ / scalar};
+  }
+  GEOMETRY_INSTRUMENT_COUNT(kPointDivisionByZero);
+  return {std::numeric_limits<double>::quiet_NaN(),
+          std::numeric_limits<double>::quiet_NaN()};
+}
+
+GEOMETRY_HOT_PATH auto Point2D::operator==(const Point2D& other) const
+    -> bool {
+  return (x_ == other.x_) && (y_ == other.y_);
+}
+
+GEOMETRY_HOT_PATH auto Point2D::operator!=(const Point2D& other) const
+    -> bool {
+  return !(*this == other);
+}
+}  // namespace geometry
+
+#endif  // GEOMETRY__POINT_2D_INLINE_HPP_
@@ -0,0 +1,78 @@
+/**
+ * @file geometry/polyline_distance.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Hausdorff and discrete Frechet distances between Point2D sequences
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__POLYLINE_DISTANCE_HPP_
+#define GEOMETRY__POLYLINE_DISTANCE_HPP_
+
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/point2d.hpp"
+
+namespace geometry {
+/**
+ * @brief Calculate the symmetric Hausdorff distance between two point
+ * sequences. Points are visited in a fixed pseudo-random order and the inner
+ * search breaks as soon as a point cannot raise the running maximum.
+ * @param lhs The first sequence.
+ * @param rhs The second sequence.
+ * @return Distance The Hausdorff distance.
+ * @throws std::invalid_argument If a sequence is empty.
+ */
+[[nodiscard]] auto CalculateHausdorffDistance(const std::vector<Point2D>& lhs,
+                                              const std::vector<Point2D>& rhs)
+    -> Distance;
+
+/**
+ * @brief Decide whether the Hausdorff distance is at most threshold, stopping
+ * at the first point without a partner within threshold. Partners are
+ * searched outwards from the partner of the previous point.
+ * @param lhs The first sequence.
+ * @param rhs The second sequence.
+ * @param threshold The threshold.
+ * @return true If the Hausdorff distance is at most threshold.
+ * @return false If the Hausdorff distance exceeds threshold.
+ * @throws std::invalid_argument If a sequence is empty.
+ */
+[[nodiscard]] auto IsHausdorffDistanceWithin(const std::vector<Point2D>& lhs,
+                                             const std::vector<Point2D>& rhs,
+                                             const Distance& threshold) -> bool;
+
+/**
+ * @brief Calculate the discrete Frechet distance between two point sequences
+ * with a dynamic program keeping a single row, O(n * m) time and O(m) memory.
+ * @param lhs The first sequence.
+ * @param rhs The second sequence.
+ * @return Distance The discrete Frechet distance.
+ * @throws std::invalid_argument If a sequence is empty.
+ */
+[[nodiscard]] auto CalculateDiscreteFrechetDistance(
+    const std::vector<Point2D>& lhs, const std::vector<Point2D>& rhs)
+    -> Distance;
+
+/**
+ * @brief Decide whether the discrete Frechet distance is at most threshold.
+ * Only the band of reachable cells of every row is evaluated, and the search
+ * stops as soon as a row has no reachable cell.
+ * @param lhs The first sequence.
+ * @param rhs The second sequence.
+ * @param threshold The threshold.
+ * @return true If the discrete Frechet distance is at most threshold.
+ * @return false If the discrete Frechet distance exceeds threshold.
+ * @throws std::invalid_argument If a sequence is empty.
+ */
+[[nodiscard]] auto IsDiscreteFrechetDistanceWithin(
+    const std::vector<Point2D>& lhs, const std::vector<Point2D>& rhs,
+    const Distance& threshold) -> bool;
+}  // namespace geometry
+
+#endif  // GEOMETRY__POLYLINE_DISTANCE_HPP_
@@ -0,0 +1,141 @@
+/**
+ * @file geometry/polyline_resample.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Resampling and interpolation of Point2D sequences by arc length
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__POLYLINE_RESAMPLE_HPP_
+#define GEOMETRY__POLYLINE_RESAMPLE_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/point2d.hpp"
+
+namespace geometry {
+/**
+ * @brief The enum class for interpolation between polyline vertices. Arc
+ * length is always measured along the straight segments; it picks the
+ * segment and the fraction along it that the interpolation is evaluated at.
+ */
+enum class Interpolation {
+  kLinear = 0,     ///< On the segment
+  kCatmullRom = 1  ///< Uniform Catmull-Rom spline through the vertices
+};
+
+/**
+ * @brief Resampled sequences stored back to back. Sequence i is
+ * points[offsets[i]] up to points[offsets[i + 1]].
+ */
+struct ResampledPolylines {
+  std::vector<Point2D> points;       ///< Samples of all sequences
+  std::vector<std::size_t> offsets;  ///< First sample of every sequence
+};
+
+/**
+ * @brief Get the number of samples ResamplePolyline writes: one at arc
+ * length 0 and one at every further multiple of spacing up to the length of
+ * the sequence. Segment lengths are rounded to whole nanometers and summed
+ * exactly, so the count matches ResamplePolyline to the sample.
+ * @param points The points.
+ * @param count The number of points.
+ * @param spacing The arc length between samples.
+ * @return std::size_t The number of samples, 0 for an empty sequence.
+ * @throws std::invalid_argument If the spacing is not positive, a coordinate
+ * is not finite or the sequence is longer than the Distance range.
+ */
+[[nodiscard]] auto GetResampleCount(const Point2D* points, std::size_t count,
+                                    const Distance& spacing) -> std::size_t;
+
+/**
+ * @brief Resample a sequence at every multiple of spacing along its arc
+ * length, in one pass and without allocating.
+ * @param points The points.
+ * @param count The number of points.
+ * @param spacing The arc length between samples.
+ * @param interpolation The interpolation.
+ * @param samples The output, GetResampleCount entries.
+ * @return std::size_t The number of samples written.
+ * @throws std::invalid_argument If the spacing is not positive, a coordinate
+ * is not finite or the sequence is longer than the Distance range.
+ */
+auto ResamplePolyline(const Point2D* points, std::size_t count,
+                      const Distance& spacing, Interpolation interpolation,
+                      Point2D* samples) -> std::size_t;
+
+/**
+ * @brief Resample a sequence at every multiple of spacing along its arc
+ * length.
+ * @param points The points.
+ * @param spacing The arc length between samples.
+ * @param interpolation The interpolation.
+ * @return std::vector<Point2D> The samples.
+ * @throws std::invalid_argument If the spacing is not positive, a coordinate
+ * is not finite or the sequence is longer than the Distance range.
+ */
+[[nodiscard]] auto ResamplePolyline(
+    const std::vector<Point2D>& points, const Distance& spacing,
+    Interpolation interpolation = Interpolation::kLinear)
+    -> std::vector<Point2D>;
+
+/**
+ * @brief Resample many sequences in parallel into one allocation.
+ * @param polylines The sequences.
+ * @param spacing The arc length between samples.
+ * @param interpolation The interpolation.
+ * @param thread_count The number of worker threads, 0 for all hardware
+ * threads.
+ * @return ResampledPolylines The samples of every sequence.
+ * @throws std::invalid_argument If the spacing is not positive, a coordinate
+ * is not finite or a sequence is longer than the Distance range.
+ */
+[[nodiscard]] auto ResamplePolylines(
+    const std::vector<std::vector<Point2D>>& polylines,
+    const Distance& spacing,
+    Interpolation interpolation = Interpolation::kLinear,
+    std::size_t thread_count = 0) -> ResampledPolylines;
+
+/**
+ * @brief Interpolate positions at arbitrary arc lengths along a sequence.
+ * Arc lengths outside the sequence are clamped to its ends. Segments are found
+ * by binary search over the cumulative lengths, starting after the segment
+ * of the previous arc length while they ascend.
+ * @param points The points.
+ * @param count The number of points.
+ * @param arc_lengths The arc lengths.
+ * @param arc_length_count The number of arc lengths.
+ * @param interpolation The interpolation.
+ * @param positions The output, arc_length_count entries.
+ * @throws std::invalid_argument If the sequence is empty, a coordinate is
+ * not finite or the sequence is longer than the Distance range.
+ */
+auto InterpolateAtArcLengths(const Point2D* points, std::size_t count,
+                             const Distance* arc_lengths,
+                             std::size_t arc_length_count,
+                             Interpolation interpolation, Point2D* positions)
+    -> void;
+
+/**
+ * @brief Interpolate positions at arbitrary arc lengths along a sequence.
+ * @param points The points.
+ * @param arc_lengths The arc lengths.
+ * @param interpolation The interpolation.
+ * @return std::vector<Point2D> The position at every arc length.
+ * @throws std::invalid_argument If the sequence is empty, a coordinate is
+ * not finite or the sequence is longer than the Distance range.
+ */
+[[nodiscard]] auto InterpolateAtArcLengths(
+    const std::vector<Point2D>& points,
+    const std::vector<Distance>& arc_lengths,
+    Interpolation interpolation = Interpolation::kLinear)
+    -> std::vector<Point2D>;
+}  // namespace geometry
+
+#endif  // GEOMETRY__POLYLINE_RESAMPLE_HPP_
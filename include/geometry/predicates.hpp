@@ -0,0 +1,138 @@
+/**
+ * @file geometry/predicates.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Robust orientation and in-circle predicates with adaptive precision
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__PREDICATES_HPP_
+#define GEOMETRY__PREDICATES_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include "geometry/point2d.hpp"
+
+namespace geometry {
+/**
+ * @brief Orientation of three points, after Shewchuk's adaptive predicates.
+ * A floating point error bound settles almost every call in a few flops, and
+ * only uncertain calls refine the determinant with exact expansion
+ * arithmetic. The sign is exact unless an intermediate value overflows or
+ * underflows, the magnitude is approximate.
+ * @param a_x The x coordinate of the first point.
+ * @param a_y The y coordinate of the first point.
+ * @param b_x The x coordinate of the second point.
+ * @param b_y The y coordinate of the second point.
+ * @param c_x The x coordinate of the third point.
+ * @param c_y The y coordinate of the third point.
+ * @return double Positive if the points are counter-clockwise, negative if
+ * they are clockwise and zero if they are collinear.
+ */
+[[nodiscard]] auto Orient2D(double a_x, double a_y, double b_x, double b_y,
+                            double c_x, double c_y) -> double;
+
+/**
+ * @brief Orientation of three points, exact in sign.
+ * @param a The first point.
+ * @param b The second point.
+ * @param c The third point.
+ * @return double Positive if the points are counter-clockwise, negative if
+ * they are clockwise and zero if they are collinear.
+ */
+[[nodiscard]] auto Orient2D(const Point2D& a, const Point2D& b,
+                            const Point2D& c) -> double;
+
+/**
+ * @brief Orientation of every point relative to the directed line through a
+ * and b. The filter runs over a whole block before the uncertain points are
+ * refined.
+ * @param a The first point of the line.
+ * @param b The second point of the line.
+ * @param points The first point.
+ * @param count The number of points.
+ * @param results The count orientations, positive left of the line.
+ */
+auto Orient2D(const Point2D& a, const Point2D& b, const Point2D* points,
+              std::size_t count, double* results) -> void;
+
+/**
+ * @brief Orientation of every point relative to the directed line through a
+ * and b.
+ * @param a The first point of the line.
+ * @param b The second point of the line.
+ * @param points The points.
+ * @return std::vector<double> The orientations, positive left of the line.
+ */
+[[nodiscard]] auto Orient2D(const Point2D& a, const Point2D& b,
+                            const std::vector<Point2D>& points)
+    -> std::vector<double>;
+
+/**
+ * @brief Position of a point relative to the circle through three
+ * counter-clockwise points, after Shewchuk's adaptive predicates. The sign is
+ * exact unless an intermediate value overflows or underflows.
+ * @param a_x The x coordinate of the first point on the circle.
+ * @param a_y The y coordinate of the first point on the circle.
+ * @param b_x The x coordinate of the second point on the circle.
+ * @param b_y The y coordinate of the second point on the circle.
+ * @param c_x The x coordinate of the third point on the circle.
+ * @param c_y The y coordinate of the third point on the circle.
+ * @param d_x The x coordinate of the tested point.
+ * @param d_y The y coordinate of the tested point.
+ * @return double Positive if the point lies inside the circle, negative if
+ * it lies outside and zero if it lies on it. The sign flips for clockwise
+ * circle points.
+ */
+[[nodiscard]] auto InCircle(double a_x, double a_y, double b_x, double b_y,
+                            double c_x, double c_y, double d_x, double d_y)
+    -> double;
+
+/**
+ * @brief Position of a point relative to the circle through three
+ * counter-clockwise points, exact in sign.
+ * @param a The first point on the circle.
+ * @param b The second point on the circle.
+ * @param c The third point on the circle.
+ * @param d The tested point.
+ * @return double Positive inside the circle, negative outside, zero on it.
+ */
+[[nodiscard]] auto InCircle(const Point2D& a, const Point2D& b,
+                            const Point2D& c, const Point2D& d) -> double;
+
+/**
+ * @brief Position of every point relative to the circle through three
+ * counter-clockwise points. The filter runs over a whole block before the
+ * uncertain points are refined.
+ * @param a The first point on the circle.
+ * @param b The second point on the circle.
+ * @param c The third point on the circle.
+ * @param points The first tested point.
+ * @param count The number of tested points.
+ * @param results The count positions, positive inside the circle.
+ */
+auto InCircle(const Point2D& a, const Point2D& b, const Point2D& c,
+              const Point2D* points, std::size_t count, double* results)
+    -> void;
+
+/**
+ * @brief Position of every point relative to the circle through three
+ * counter-clockwise points.
+ * @param a The first point on the circle.
+ * @param b The second point on the circle.
+ * @param c The third point on the circle.
+ * @param points The tested points.
+ * @return std::vector<double> The positions, positive inside the circle.
+ */
+[[nodiscard]] auto InCircle(const Point2D& a, const Point2D& b,
+                            const Point2D& c,
+                            const std::vector<Point2D>& points)
+    -> std::vector<double>;
+}  // namespace geometry
+
+#endif  // GEOMETRY__PREDICATES_HPP_
@@ -0,0 +1,132 @@
+/**
+ * @file geometry/space_filling_curve.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Morton and Hilbert curve keys and curve ordering of point arrays
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__SPACE_FILLING_CURVE_HPP_
+#define GEOMETRY__SPACE_FILLING_CURVE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "geometry/point2d.hpp"
+
+namespace geometry {
+/**
+ * @brief Space filling curve of a key.
+ */
+enum class SpaceFillingCurve {
+  kMorton = 0,  ///< Z-order, bit interleaving
+  kHilbert = 1  ///< Hilbert curve, no jumps between consecutive cells
+};
+
+/**
+ * @brief Interleave the bits of two grid coordinates, x in the even bits.
+ * Uses the BMI2 pdep instruction on the AVX2 and AVX-512 kernel paths.
+ * @param x The column.
+ * @param y The row.
+ * @return uint64_t The Morton key.
+ */
+[[nodiscard]] auto EncodeMorton(uint32_t x, uint32_t y) -> uint64_t;
+
+/**
+ * @brief Position of a grid cell along the Hilbert curve of order 32, which
+ * starts at cell (0, 0). Cells with both coordinates below 2^k occupy the
+ * first 4^k positions.
+ * @param x The column.
+ * @param y The row.
+ * @return uint64_t The Hilbert key.
+ */
+[[nodiscard]] auto EncodeHilbert(uint32_t x, uint32_t y) -> uint64_t;
+
+/**
+ * @brief Curve key of a point on a grid of 2^32 by 2^32 cells spanning a
+ * bounding box. Points outside the box take the key of the nearest cell.
+ * @param point The point.
+ * @param min_corner The lower left corner of the box.
+ * @param max_corner The upper right corner of the box.
+ * @param curve The curve.
+ * @return uint64_t The key.
+ */
+[[nodiscard]] auto ComputeCurveKey(const Point2D& point,
+                                   const Point2D& min_corner,
+                                   const Point2D& max_corner,
+                                   SpaceFillingCurve curve) -> uint64_t;
+
+/**
+ * @brief Curve keys of count points over a bounding box.
+ * @param points The first point.
+ * @param count The number of points.
+ * @param min_corner The lower left corner of the box.
+ * @param max_corner The upper right corner of the box.
+ * @param curve The curve.
+ * @param keys The count keys.
+ */
+auto ComputeCurveKeys(const Point2D* points, std::size_t count,
+                      const Point2D& min_corner, const Point2D& max_corner,
+                      SpaceFillingCurve curve, uint64_t* keys) -> void;
+
+/**
+ * @brief Order of points along a curve over their bounding box, from a
+ * parallel radix sort of their keys. Points with equal keys keep their input
+ * order.
+ * @param points The points.
+ * @param curve The curve.
+ * @param thread_count The number of worker threads, 0 for all hardware
+ * threads.
+ * @return std::vector<uint32_t> The permutation, the input index of each
+ * position in curve order.
+ * @throws std::invalid_argument If there are 2^32 points or more.
+ */
+[[nodiscard]] auto ComputeCurveOrder(const std::vector<Point2D>& points,
+                                     SpaceFillingCurve curve,
+                                     std::size_t thread_count = 0)
+    -> std::vector<uint32_t>;
+
+/**
+ * @brief Gather values into a permuted order, as for payload arrays that
+ * follow points reordered along a curve.
+ * @param permutation The input index of each output position.
+ * @param values The values, permuted in place.
+ * @throws std::invalid_argument If the sizes differ.
+ */
+template <typename Value>
+auto ApplyPermutation(const std::vector<uint32_t>& permutation,
+                      std::vector<Value>& values) -> void {
+  if (permutation.size() != values.size()) {
+    throw std::invalid_argument("Invalid input: Permutation size mismatch");
+  }
+  std::vector<Value> permuted;
+  permuted.reserve(values.size());
+  for (const uint32_t index : permutation) {
+    permuted.push_back(std::move(values[index]));
+  }
+  values.swap(permuted);
+}
+
+/**
+ * @brief Reorder points along a curve over their bounding box, so that
+ * points close in space are close in memory.
+ * @param points The points, permuted in place.
+ * @param curve The curve.
+ * @param thread_count The number of worker threads, 0 for all hardware
+ * threads.
+ * @return std::vector<uint32_t> The permutation, to pass to ApplyPermutation
+ * for payload arrays.
+ * @throws std::invalid_argument If there are 2^32 points or more.
+ */
+auto ReorderAlongCurve(std::vector<Point2D>& points, SpaceFillingCurve curve,
+                       std::size_t thread_count = 0) -> std::vector<uint32_t>;
+}  // namespace geometry
+
+#endif  // GEOMETRY__SPACE_FILLING_CURVE_HPP_
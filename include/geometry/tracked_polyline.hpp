@@ -0,0 +1,260 @@
+/**
+ * @file geometry/tracked_polyline.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Point2D sequence with cached derived geometry refreshed per block
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__TRACKED_POLYLINE_HPP_
+#define GEOMETRY__TRACKED_POLYLINE_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/accumulators.hpp"
+#include "geometry/distance.hpp"
+#include "geometry/point2d.hpp"
+
+namespace geometry {
+/**
+ * @brief Point2D sequence that tracks edits in blocks of kBlockSize points.
+ * Every block caches its bounding box, centroid sums and arc lengths, and a
+ * binary tree over the blocks merges them up to the whole sequence and
+ * doubles as a bounding volume hierarchy for radius queries. An edit only
+ * raises the version of the blocks it touches; the next query refreshes
+ * those blocks and the tree paths above them, so a few edits cost a few
+ * blocks instead of a rescan. Point2D coordinates are interpreted in meters
+ * and segment lengths are rounded to whole nanometers, so arc lengths add up
+ * exactly. Queries refresh the caches in place: a TrackedPolyline may be
+ * queried from several threads only after Refresh and without edits.
+ */
+class TrackedPolyline {
+ public:
+  static constexpr std::size_t kBlockSize{64};  ///< Points per block
+
+  /**
+   * @brief Construct an empty TrackedPolyline object.
+   */
+  TrackedPolyline() = default;
+
+  /**
+   * @brief Construct a new TrackedPolyline object.
+   * @param points The points.
+   * @throws std::invalid_argument If a coordinate is not finite, the length
+   * is outside the Distance range or there are more than 2^32 - 1 points.
+   */
+  explicit TrackedPolyline(std::vector<Point2D> points);
+
+  /**
+   * @brief Get the number of points.
+   * @return std::size_t The number of points.
+   */
+  [[nodiscard]] auto GetSize() const -> std::size_t { return points_.size(); }
+
+  /**
+   * @brief Get a point.
+   * @param index The index, below GetSize.
+   * @return const Point2D& The point.
+   */
+  [[nodiscard]] auto Get(std::size_t index) const -> const Point2D& {
+    return points_[index];
+  }
+
+  /**
+   * @brief Get the points.
+   * @return const std::vector<Point2D>& The points.
+   */
+  [[nodiscard]] auto GetPoints() const -> const std::vector<Point2D>& {
+    return points_;
+  }
+
+  /**
+   * @brief Move a point.
+   * @param index The index.
+   * @param point The new position.
+   * @throws std::invalid_argument If the index is out of range, a coordinate
+   * is not finite or the length would leave the Distance range.
+   */
+  auto Set(std::size_t index, const Point2D& point) -> void;
+
+  /**
+   * @brief Set the x coordinate of a point.
+   * @param index The index.
+   * @param x The new x coordinate.
+   * @throws std::invalid_argument If the index is out of range, x is not
+   * finite or the length would leave the Distance range.
+   */
+  auto SetX(std::size_t index, double x) -> void;
+
+  /**
+   * @brief Set the y coordinate of a point.
+   * @param index The index.
+   * @param y The new y coordinate.
+   * @throws std::invalid_argument If the index is out of range, y is not
+   * finite or the length would leave the Distance range.
+   */
+  auto SetY(std::size_t index, double y) -> void;
+
+  /**
+   * @brief Append a point.
+   * @param point The point.
+   * @throws std::invalid_argument If a coordinate is not finite, the length
+   * would leave the Distance range or there would be more than 2^32 - 1
+   * points.
+   */
+  auto PushBack(const Point2D& point) -> void;
+
+  /**
+   * @brief Get the number of edits so far.
+   * @return uint64_t The version of the sequence.
+   */
+  [[nodiscard]] auto GetVersion() const -> uint64_t { return version_; }
+
+  /**
+   * @brief Get the number of blocks.
+   * @return std::size_t The number of blocks.
+   */
+  [[nodiscard]] auto GetBlockCount() const -> std::size_t {
+    return block_versions_.size();
+  }
+
+  /**
+   * @brief Get the version of a block, raised by every edit of its points or
+   * of the segment leaving it.
+   * @param block The block, below GetBlockCount.
+   * @return uint64_t The version.
+   */
+  [[nodiscard]] auto GetBlockVersion(std::size_t block) const -> uint64_t {
+    return block_versions_[block];
+  }
+
+  /**
+   * @brief Get the number of blocks edited since the last refresh.
+   * @return std::size_t The number of stale blocks.
+   */
+  [[nodiscard]] auto GetStaleBlockCount() const -> std::size_t {
+    return stale_blocks_.size();
+  }
+
+  /**
+   * @brief Bring the cached geometry up to date with the edits. Queries call
+   * it themselves.
+   */
+  auto Refresh() const -> void;
+
+  /**
+   * @brief Get the bounding box of the points.
+   * @return const BoundingBoxAccumulator& The bounding box.
+   */
+  [[nodiscard]] auto GetBoundingBox() const -> const BoundingBoxAccumulator&;
+
+  /**
+   * @brief Get the centroid of the points.
+   * @return Point2D The centroid.
+   * @throws std::logic_error If there are no points.
+   */
+  [[nodiscard]] auto GetCentroid() const -> Point2D;
+
+  /**
+   * @brief Get the length of the sequence.
+   * @return Distance The length.
+   */
+  [[nodiscard]] auto GetLength() const -> Distance;
+
+  /**
+   * @brief Get the arc length from the first point to a point.
+   * @param index The index.
+   * @return Distance The arc length.
+   * @throws std::invalid_argument If the index is out of range.
+   */
+  [[nodiscard]] auto GetArcLength(std::size_t index) const -> Distance;
+
+  /**
+   * @brief Visit every point within radius of center, pruning blocks by the
+   * cached bounding boxes.
+   * @param center The query point.
+   * @param radius The query radius.
+   * @param visitor Called as visitor(index, squared_distance). It must not
+   * edit the sequence.
+   */
+  template <typename Visitor>
+  auto ForEachInRadius(const Point2D& center, const Distance& radius,
+                       Visitor&& visitor) const -> void {
+    Refresh();
+    if (points_.empty()) {
+      return;
+    }
+    const double range{radius.GetValue(Distance::Type::kMeter)};
+    const double squared_range{range * range};
+    const double x{center.GetX()};
+    const double y{center.GetY()};
+    // Depth first, at most one pending sibling per level.
+    std::array<std::size_t, 64> pending{};
+    std::size_t depth{0};
+    pending[depth++] = 1;
+    while (depth != 0) {
+      const std::size_t node{pending[--depth]};
+      const auto& box{nodes_[node].box.GetState()};
+      const double dx{std::max({box.min_x - x, 0.0, x - box.max_x})};
+      const double dy{std::max({box.min_y - y, 0.0, y - box.max_y})};
+      if (box.count == 0 || (dx * dx) + (dy * dy) > squared_range) {
+        continue;
+      }
+      if (node < leaf_count_) {
+        pending[depth++] = (2 * node) + 1;
+        pending[depth++] = 2 * node;
+        continue;
+      }
+      const std::size_t begin{(node - leaf_count_) * kBlockSize};
+      const std::size_t end{std::min(begin + kBlockSize, points_.size())};
+      for (std::size_t index = begin; index < end; ++index) {
+        const double px{points_[index].GetX() - x};
+        const double py{points_[index].GetY() - y};
+        const double squared{(px * px) + (py * py)};
+        if (squared <= squared_range) {
+          visitor(static_cast<uint32_t>(index), squared);
+        }
+      }
+    }
+  }
+
+ protected:
+ private:
+  /**
+   * @brief Cached geometry of a block, or merged over the blocks below a
+   * tree node.
+   */
+  struct Node {
+    BoundingBoxAccumulator box;    ///< Bounding box of the points
+    CentroidAccumulator centroid;  ///< Compensated coordinate sums
+    int64_t length{0};             ///< Nanometers of the segments leaving
+  };
+
+  auto CheckEdit(std::size_t index, const Point2D& point) const -> int64_t;
+  auto Touch(std::size_t index) -> void;
+  auto MarkStale(std::size_t block) -> void;
+  auto RefreshBlock(std::size_t block) const -> void;
+  auto Grow() -> void;
+  auto MergeChildren(std::size_t node) const -> void;
+
+  std::vector<Point2D> points_;          ///< The points
+  std::vector<uint64_t> block_versions_;  ///< Edit version of every block
+  uint64_t version_{0};                  ///< Number of edits
+  int64_t length_{0};                    ///< Nanometers of all segments
+  mutable std::vector<uint64_t> refreshed_versions_;  ///< Cached versions
+  mutable std::vector<std::size_t> stale_blocks_;  ///< Blocks to refresh
+  mutable std::vector<int64_t> block_arcs_;  ///< Nanometers from block start
+  mutable std::vector<Node> nodes_{2};  ///< Tree from the root at 1
+  std::size_t leaf_count_{1};           ///< Leaves, a power of two
+};
+}  // namespace geometry
+
+#endif  // GEOMETRY__TRACKED_POLYLINE_HPP_
@@ -0,0 +1,205 @@
+/**
+ * @file geometry/trajectory_codec.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Quantised delta and bit-packing codec for Point2D trajectories
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__TRAJECTORY_CODEC_HPP_
+#define GEOMETRY__TRAJECTORY_CODEC_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/point2d.hpp"
+
+namespace geometry {
+/**
+ * @brief Streaming encoder of Point2D trajectories. Coordinates are rounded
+ * to a grid of the given resolution, so every decoded coordinate is within
+ * half the resolution of its input. Consecutive grid points are delta
+ * encoded, zigzag mapped and bit-packed in blocks of up to kBlockSize points
+ * with one bit width per axis and block.
+ *
+ * The byte stream is a header of the magic byte 'T', the format version and
+ * the resolution in nanometers as an LEB128 varint, followed by blocks of a
+ * point count byte, the x and y bit widths and the little-endian bit-packed
+ * x and y deltas, each padded to a whole byte.
+ */
+class TrajectoryEncoder {
+ public:
+  /**
+   * @brief Maximum number of points of a block.
+   */
+  static constexpr std::size_t kBlockSize{128};
+
+  /**
+   * @brief Construct a new TrajectoryEncoder object and write the header.
+   * @param resolution The grid resolution.
+   * @throws std::invalid_argument If the resolution is not positive.
+   */
+  explicit TrajectoryEncoder(const Distance& resolution);
+
+  /**
+   * @brief Append a point, closing a block every kBlockSize points.
+   * @param point The point.
+   * @throws std::invalid_argument If a coordinate is not finite or too far
+   * from the origin to be quantised to 63 bits.
+   */
+  auto Add(const Point2D& point) -> void;
+
+  /**
+   * @brief Append points.
+   * @param points The points.
+   * @throws std::invalid_argument If a coordinate is not finite or too far
+   * from the origin to be quantised to 63 bits.
+   */
+  auto Add(const std::vector<Point2D>& points) -> void;
+
+  /**
+   * @brief Close the pending block, if any, so that every point added so far
+   * is in the bytes.
+   */
+  auto Flush() -> void;
+
+  /**
+   * @brief Get the bytes written since the last TakeBytes call.
+   * @return const std::vector<uint8_t>& The bytes.
+   */
+  [[nodiscard]] auto GetBytes() const -> const std::vector<uint8_t>& {
+    return bytes_;
+  }
+
+  /**
+   * @brief Move the bytes written so far out of the encoder.
+   * @return std::vector<uint8_t> The bytes.
+   */
+  auto TakeBytes() -> std::vector<uint8_t>;
+
+  /**
+   * @brief Get the number of points added.
+   * @return std::size_t The number of points.
+   */
+  [[nodiscard]] auto GetPointCount() const -> std::size_t {
+    return point_count_;
+  }
+
+ protected:
+ private:
+  double inverse_resolution_;                 ///< Grid cells per meter
+  std::array<int64_t, kBlockSize> xs_{};      ///< Pending quantised x
+  std::array<int64_t, kBlockSize> ys_{};      ///< Pending quantised y
+  std::size_t pending_{0};                    ///< Number of pending points
+  int64_t previous_x_{0};                     ///< Last quantised x written
+  int64_t previous_y_{0};                     ///< Last quantised y written
+  std::size_t point_count_{0};                ///< Number of points added
+  std::vector<uint8_t> bytes_;                ///< Encoded bytes
+};
+
+/**
+ * @brief Streaming decoder of the TrajectoryEncoder format. Bytes can be fed
+ * in pieces of any size; complete blocks are decoded as soon as they arrive.
+ */
+class TrajectoryDecoder {
+ public:
+  /**
+   * @brief Construct a new TrajectoryDecoder object.
+   */
+  TrajectoryDecoder() = default;
+
+  /**
+   * @brief Append encoded bytes.
+   * @param data The first byte.
+   * @param size The number of bytes.
+   */
+  auto Feed(const uint8_t* data, std::size_t size) -> void;
+
+  /**
+   * @brief Append encoded bytes.
+   * @param bytes The bytes.
+   */
+  auto Feed(const std::vector<uint8_t>& bytes) -> void {
+    Feed(bytes.data(), bytes.size());
+  }
+
+  /**
+   * @brief Decode every complete block fed so far.
+   * @param points The decoded points are appended here.
+   * @return std::size_t The number of points appended.
+   * @throws std::invalid_argument If the stream is not in the format.
+   */
+  auto Read(std::vector<Point2D>& points) -> std::size_t;
+
+  /**
+   * @brief Decode every complete block fed so far into coordinate arrays,
+   * which skips the construction of Point2D objects.
+   * @param xs The decoded x coordinates are appended here.
+   * @param ys The decoded y coordinates are appended here.
+   * @return std::size_t The number of points appended.
+   * @throws std::invalid_argument If the stream is not in the format.
+   */
+  auto Read(std::vector<double>& xs, std::vector<double>& ys) -> std::size_t;
+
+  /**
+   * @brief Whether no partial header or block is buffered, which holds at the
+   * end of a complete stream.
+   * @return true If all fed bytes were decoded.
+   * @return false If bytes are waiting for the rest of their block.
+   */
+  [[nodiscard]] auto IsIdle() const -> bool {
+    return offset_ == buffer_.size();
+  }
+
+  /**
+   * @brief Get the grid resolution of the stream.
+   * @return Distance The resolution.
+   * @throws std::logic_error If the header was not read yet.
+   */
+  [[nodiscard]] auto GetResolution() const -> Distance;
+
+ protected:
+ private:
+  auto ReadHeader() -> bool;
+  auto FindBlocks(std::size_t& end) -> std::size_t;
+  auto DecodeBlock(double* xs, double* ys) -> std::size_t;
+
+  std::vector<uint8_t> buffer_;   ///< Fed bytes not decoded yet
+  std::size_t offset_{0};         ///< First undecoded byte of buffer_
+  bool has_header_{false};        ///< Whether the header was read
+  int64_t resolution_{0};         ///< Resolution in nanometers
+  double resolution_meter_{0.0};  ///< Resolution in meters
+  uint64_t previous_x_{0};        ///< Last quantised x, two's complement
+  uint64_t previous_y_{0};        ///< Last quantised y, two's complement
+};
+
+/**
+ * @brief Encode a whole trajectory.
+ * @param points The trajectory.
+ * @param resolution The grid resolution.
+ * @return std::vector<uint8_t> The encoded bytes.
+ * @throws std::invalid_argument If the resolution is not positive or a
+ * coordinate cannot be quantised.
+ */
+[[nodiscard]] auto EncodeTrajectory(const std::vector<Point2D>& points,
+                                    const Distance& resolution)
+    -> std::vector<uint8_t>;
+
+/**
+ * @brief Decode a whole trajectory.
+ * @param bytes The encoded bytes.
+ * @return std::vector<Point2D> The trajectory.
+ * @throws std::invalid_argument If the bytes are not a complete stream.
+ */
+[[nodiscard]] auto DecodeTrajectory(const std::vector<uint8_t>& bytes)
+    -> std::vector<Point2D>;
+}  // namespace geometry
+
+#endif  // GEOMETRY__TRAJECTORY_CODEC_HPP_
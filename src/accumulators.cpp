@@ -0,0 +1,282 @@
+/**
+ * @file geometry/accumulators.cpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Mergeable streaming accumulators over Point2D streams
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/accumulators.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+// Span updates of the covariance run two passes over chunks of this many
+// points, small enough to stay in cache between the passes.
+constexpr std::size_t kChunkSize{4096};
+
+/**
+ * @brief Neumaier's compensated addition of value to sum.
+ */
+inline auto CompensatedAdd(double& sum, double& compensation, double value)
+    -> void {
+  const double total{sum + value};
+  if (std::abs(sum) >= std::abs(value)) {
+    compensation += (sum - total) + value;
+  } else {
+    compensation += (value - total) + sum;
+  }
+  sum = total;
+}
+
+auto CheckNotEmpty(uint64_t count) -> void {
+  if (count == 0) {
+    throw std::logic_error("Invalid state: Empty accumulator");
+  }
+}
+
+inline auto SquaredDistance(
+    const geometry::DistanceRangeAccumulator::State& state,
+    const geometry::Point2D& point) -> double {
+  const double dx{point.GetX() - state.reference_x};
+  const double dy{point.GetY() - state.reference_y};
+  return (dx * dx) + (dy * dy);
+}
+}  // namespace
+
+namespace geometry {
+
+auto CentroidAccumulator::Add(const Point2D& point) -> void {
+  ++state_.count;
+  CompensatedAdd(state_.sum_x, state_.compensation_x, point.GetX());
+  CompensatedAdd(state_.sum_y, state_.compensation_y, point.GetY());
+}
+
+auto CentroidAccumulator::Add(const Point2D* points, std::size_t count)
+    -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    CompensatedAdd(state_.sum_x, state_.compensation_x, points[i].GetX());
+    CompensatedAdd(state_.sum_y, state_.compensation_y, points[i].GetY());
+  }
+  state_.count += count;
+}
+
+auto CentroidAccumulator::Merge(const CentroidAccumulator& other) -> void {
+  state_.count += other.state_.count;
+  CompensatedAdd(state_.sum_x, state_.compensation_x, other.state_.sum_x);
+  CompensatedAdd(state_.sum_y, state_.compensation_y, other.state_.sum_y);
+  state_.compensation_x += other.state_.compensation_x;
+  state_.compensation_y += other.state_.compensation_y;
+}
+
+auto CentroidAccumulator::GetCentroid() const -> Point2D {
+  CheckNotEmpty(state_.count);
+  const auto count{static_cast<double>(state_.count)};
+  return Point2D((state_.sum_x + state_.compensation_x) / count,
+                 (state_.sum_y + state_.compensation_y) / count);
+}
+
+auto BoundingBoxAccumulator::Add(const Point2D& point) -> void {
+  Add(&point, 1);
+}
+
+auto BoundingBoxAccumulator::Add(const Point2D* points, std::size_t count)
+    -> void {
+  if (count == 0) {
+    return;
+  }
+  if (state_.count == 0) {
+    state_.min_x = state_.max_x = points[0].GetX();
+    state_.min_y = state_.max_y = points[0].GetY();
+  }
+  for (std::size_t i = 0; i < count; ++i) {
+    const double x{points[i].GetX()};
+    const double y{points[i].GetY()};
+    state_.min_x = std::min(state_.min_x, x);
+    state_.max_x = std::max(state_.max_x, x);
+    state_.min_y = std::min(state_.min_y, y);
+    state_.max_y = std::max(state_.max_y, y);
+  }
+  state_.count += count;
+}
+
+auto BoundingBoxAccumulator::Merge(const BoundingBoxAccumulator& other)
+    -> void {
+  if (other.state_.count == 0) {
+    return;
+  }
+  if (state_.count == 0) {
+    state_ = other.state_;
+    return;
+  }
+  state_.count += other.state_.count;
+  state_.min_x = std::min(state_.min_x, other.state_.min_x);
+  state_.min_y = std::min(state_.min_y, other.state_.min_y);
+  state_.max_x = std::max(state_.max_x, other.state_.max_x);
+  state_.max_y = std::max(state_.max_y, other.state_.max_y);
+}
+
+auto BoundingBoxAccumulator::GetMinCorner() const -> Point2D {
+  CheckNotEmpty(state_.count);
+  return Point2D(state_.min_x, state_.min_y);
+}
+
+auto BoundingBoxAccumulator::GetMaxCorner() const -> Point2D {
+  CheckNotEmpty(state_.count);
+  return Point2D(state_.max_x, state_.max_y);
+}
+
+DistanceRangeAccumulator::DistanceRangeAccumulator(const Point2D& reference) {
+  state_.reference_x = reference.GetX();
+  state_.reference_y = reference.GetY();
+}
+
+auto DistanceRangeAccumulator::Add(const Point2D& point) -> void {
+  Add(&point, 1);
+}
+
+auto DistanceRangeAccumulator::Add(const Point2D* points, std::size_t count)
+    -> void {
+  if (count == 0) {
+    return;
+  }
+  if (state_.count == 0) {
+    state_.min_squared = SquaredDistance(state_, points[0]);
+    state_.max_squared = state_.min_squared;
+  }
+  for (std::size_t i = 0; i < count; ++i) {
+    const double squared{SquaredDistance(state_, points[i])};
+    state_.min_squared = std::min(state_.min_squared, squared);
+    state_.max_squared = std::max(state_.max_squared, squared);
+  }
+  state_.count += count;
+}
+
+auto DistanceRangeAccumulator::Merge(const DistanceRangeAccumulator& other)
+    -> void {
+  if (state_.reference_x != other.state_.reference_x ||
+      state_.reference_y != other.state_.reference_y) {
+    throw std::invalid_argument("Invalid input: Different reference points");
+  }
+  if (other.state_.count == 0) {
+    return;
+  }
+  if (state_.count == 0) {
+    state_ = other.state_;
+    return;
+  }
+  state_.count += other.state_.count;
+  state_.min_squared = std::min(state_.min_squared, other.state_.min_squared);
+  state_.max_squared = std::max(state_.max_squared, other.state_.max_squared);
+}
+
+auto DistanceRangeAccumulator::GetReference() const -> Point2D {
+  return Point2D(state_.reference_x, state_.reference_y);
+}
+
+auto DistanceRangeAccumulator::GetMin() const -> Distance {
+  CheckNotEmpty(state_.count);
+  return Distance(std::sqrt(state_.min_squared), Distance::Type::kMeter);
+}
+
+auto DistanceRangeAccumulator::GetMax() const -> Distance {
+  CheckNotEmpty(state_.count);
+  return Distance(std::sqrt(state_.max_squared), Distance::Type::kMeter);
+}
+
+auto CovarianceAccumulator::Add(const Point2D& point) -> void {
+  ++state_.count;
+  const auto count{static_cast<double>(state_.count)};
+  const double dx{point.GetX() - state_.mean_x};
+  const double dy{point.GetY() - state_.mean_y};
+  state_.mean_x += dx / count;
+  state_.mean_y += dy / count;
+  state_.moment_xx += dx * (point.GetX() - state_.mean_x);
+  state_.moment_xy += dx * (point.GetY() - state_.mean_y);
+  state_.moment_yy += dy * (point.GetY() - state_.mean_y);
+}
+
+auto CovarianceAccumulator::Add(const Point2D* points, std::size_t count)
+    -> void {
+  for (std::size_t begin = 0; begin < count; begin += kChunkSize) {
+    const std::size_t end{std::min(count, begin + kChunkSize)};
+    const auto size{static_cast<double>(end - begin)};
+    State chunk;
+    chunk.count = end - begin;
+    double sum_x{0.0};
+    double sum_y{0.0};
+    for (std::size_t i = begin; i < end; ++i) {
+      sum_x += points[i].GetX();
+      sum_y += points[i].GetY();
+    }
+    chunk.mean_x = sum_x / size;
+    chunk.mean_y = sum_y / size;
+    for (std::size_t i = begin; i < end; ++i) {
+      const double dx{points[i].GetX() - chunk.mean_x};
+      const double dy{points[i].GetY() - chunk.mean_y};
+      chunk.moment_xx += dx * dx;
+      chunk.moment_xy += dx * dy;
+      chunk.moment_yy += dy * dy;
+    }
+    Merge(CovarianceAccumulator(chunk));
+  }
+}
+
+auto CovarianceAccumulator::Merge(const CovarianceAccumulator& other) -> void {
+  const State& rhs{other.state_};
+  if (rhs.count == 0) {
+    return;
+  }
+  if (state_.count == 0) {
+    state_ = rhs;
+    return;
+  }
+  // Chan et al.: shift both partials to the combined mean.
+  const auto lhs_count{static_cast<double>(state_.count)};
+  const auto rhs_count{static_cast<double>(rhs.count)};
+  const double count{lhs_count + rhs_count};
+  const double dx{rhs.mean_x - state_.mean_x};
+  const double dy{rhs.mean_y - state_.mean_y};
+  const double weight{lhs_count * rhs_count / count};
+  state_.mean_x += dx * (rhs_count / count);
+  state_.mean_y += dy * (rhs_count / count);
+  state_.moment_xx += rhs.moment_xx + (dx * dx * weight);
+  state_.moment_xy += rhs.moment_xy + (dx * dy * weight);
+  state_.moment_yy += rhs.moment_yy + (dy * dy * weight);
+  state_.count += rhs.count;
+}
+
+auto CovarianceAccumulator::GetMean() const -> Point2D {
+  CheckNotEmpty(state_.count);
+  return Point2D(state_.mean_x, state_.mean_y);
+}
+
+auto CovarianceAccumulator::GetCovariance() const -> Covariance {
+  CheckNotEmpty(state_.count);
+  const auto count{static_cast<double>(state_.count)};
+  return {state_.moment_xx / count, state_.moment_xy / count,
+          state_.moment_yy / count};
+}
+
+auto CovarianceAccumulator::GetSampleCovariance() const -> Covariance {
+  if (state_.count < 2) {
+    throw std::logic_error("Invalid state: Fewer than two points");
+  }
+  const auto count{static_cast<double>(state_.count - 1)};
+  return {state_.moment_xx / count, state_.moment_xy / count,
+          state_.moment_yy / count};
+}
+
+auto CovarianceAccumulator::GetStandardDistance() const -> Distance {
+  const Covariance covariance{GetCovariance()};
+  return Distance(std::sqrt(covariance.xx + covariance.yy),
+                  Distance::Type::kMeter);
+}
+
+}  // namespace geometry
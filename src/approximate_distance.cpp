@@ -0,0 +1,104 @@
+/**
+ * @file geometry/approximate_distance.cpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Approximate Euclidean distances with bounded relative error
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/approximate_distance.hpp"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+#include "detail/kernel_dispatch.hpp"
+
+namespace {
+constexpr std::size_t kBlockSize{256};
+
+/**
+ * @brief Batch kernel body, compiled once per kernel path.
+ */
+template <typename Norm>
+GEOMETRY_ALWAYS_INLINE auto DistancesBody(double origin_x, double origin_y,
+                                          const double* xs, const double* ys,
+                                          std::size_t count, double* distances)
+    -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    distances[i] = Norm::Compute(xs[i] - origin_x, ys[i] - origin_y);
+  }
+}
+
+/**
+ * @brief Call visitor with a value of the Norm type of the approximation.
+ */
+template <typename Visitor>
+auto Dispatch(geometry::DistanceApproximation approximation, Visitor visitor)
+    -> decltype(visitor(geometry::ExactNorm{})) {
+  switch (approximation) {
+    case geometry::DistanceApproximation::kExact:
+      return visitor(geometry::ExactNorm{});
+    case geometry::DistanceApproximation::kNewtonRsqrt:
+      return visitor(geometry::NewtonRsqrtNorm{});
+    case geometry::DistanceApproximation::kOctagonal:
+      return visitor(geometry::OctagonalNorm{});
+    case geometry::DistanceApproximation::kFloat32:
+      return visitor(geometry::Float32Norm{});
+  }
+  throw std::invalid_argument("Invalid input: Unknown distance approximation");
+}
+}  // namespace
+
+namespace geometry {
+
+auto GetMaxRelativeError(DistanceApproximation approximation) -> double {
+  return Dispatch(approximation,
+                  [](auto norm) { return decltype(norm)::kMaxRelativeError; });
+}
+
+auto ApproximateDistance(const Point2D& lhs, const Point2D& rhs,
+                         DistanceApproximation approximation) -> double {
+  return Dispatch(approximation, [&](auto norm) {
+    return ApproximateDistance<decltype(norm)>(lhs, rhs);
+  });
+}
+
+auto ApproximateDistances(const Point2D& origin, const double* xs,
+                          const double* ys, std::size_t count,
+                          double* distances,
+                          DistanceApproximation approximation) -> void {
+  Dispatch(approximation, [&](auto norm) {
+    const auto kernel{detail::DispatchKernel<&DistancesBody<decltype(norm)>>()};
+    kernel(origin.GetX(), origin.GetY(), xs, ys, count, distances);
+  });
+}
+
+auto ApproximateDistances(const Point2D& origin,
+                          const std::vector<Point2D>& points,
+                          DistanceApproximation approximation)
+    -> std::vector<double> {
+  std::vector<double> distances(points.size());
+  Dispatch(approximation, [&](auto norm) {
+    const auto kernel{detail::DispatchKernel<&DistancesBody<decltype(norm)>>()};
+    // Coordinates are gathered per block so that the kernel sees arrays.
+    std::array<double, kBlockSize> xs{};
+    std::array<double, kBlockSize> ys{};
+    for (std::size_t first = 0; first < points.size(); first += kBlockSize) {
+      const std::size_t size{std::min(kBlockSize, points.size() - first)};
+      for (std::size_t i = 0; i < size; ++i) {
+        xs[i] = points[first + i].GetX();
+        ys[i] = points[first + i].GetY();
+      }
+      kernel(origin.GetX(), origin.GetY(), xs.data(), ys.data(), size,
+             distances.data() + first);
+    }
+  });
+  return distances;
+}
+
+}  // namespace geometry
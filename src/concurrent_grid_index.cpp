@@ -0,0 +1,275 @@
+/**
+ * @file geometry/concurrent_grid_index.cpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Uniform grid over moving points with lock-free readers
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/concurrent_grid_index.hpp"
+
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+#include "geometry/instrumentation.hpp"
+
+namespace {
+constexpr uint32_t kNone{std::numeric_limits<uint32_t>::max()};
+constexpr std::size_t kMaxCellCount{std::size_t{1} << 26U};
+constexpr std::size_t kReaderSlotCount{1024};
+constexpr uint64_t kIdle{0};
+// Readers that find every slot taken share one slot holding their count in
+// the low bits and, above it, the low bits of the epoch of the first of them.
+constexpr std::size_t kSharedSlot{kReaderSlotCount};
+constexpr unsigned kSharedCountBits{24};
+constexpr uint64_t kSharedCountMask{(uint64_t{1} << kSharedCountBits) - 1};
+constexpr uint64_t kSharedEpochMask{~uint64_t{0} >> kSharedCountBits};
+
+auto CountCells(double extent, double cell_size) -> std::size_t {
+  const double cells{std::ceil(extent / cell_size)};
+  if (!(cells >= 1.0)) {
+    return 1;
+  }
+  if (cells > static_cast<double>(kMaxCellCount)) {
+    throw std::invalid_argument("Invalid input: Too many cells");
+  }
+  return static_cast<std::size_t>(cells);
+}
+}  // namespace
+
+namespace geometry {
+
+ConcurrentGridIndex::ConcurrentGridIndex(const Point2D& min_corner,
+                                         const Point2D& max_corner,
+                                         const Distance& cell_size,
+                                         std::size_t capacity)
+    : min_x_(min_corner.GetX()), min_y_(min_corner.GetY()) {
+  const double max_x{max_corner.GetX()};
+  const double max_y{max_corner.GetY()};
+  if (!std::isfinite(min_x_) || !std::isfinite(min_y_) ||
+      !std::isfinite(max_x) || !std::isfinite(max_y) || max_x < min_x_ ||
+      max_y < min_y_) {
+    throw std::invalid_argument("Invalid input: Invalid grid bounds");
+  }
+  const double size{cell_size.GetValue(Distance::Type::kMeter)};
+  if (!(size > 0.0) || !std::isfinite(size)) {
+    throw std::invalid_argument("Invalid input: Non-positive cell size");
+  }
+  if (capacity > std::size_t{kNone}) {
+    throw std::invalid_argument("Invalid input: Capacity too large");
+  }
+  columns_ = CountCells(max_x - min_x_, size);
+  rows_ = CountCells(max_y - min_y_, size);
+  if (columns_ * rows_ > kMaxCellCount) {
+    throw std::invalid_argument("Invalid input: Too many cells");
+  }
+  inverse_cell_size_ = 1.0 / size;
+
+  const std::size_t cell_count{columns_ * rows_};
+  cells_ = std::make_unique<std::atomic<const CellSnapshot*>[]>(cell_count);
+  for (std::size_t cell = 0; cell < cell_count; ++cell) {
+    cells_[cell].store(nullptr, std::memory_order_relaxed);
+  }
+  reader_slots_ = std::make_unique<ReaderSlot[]>(kReaderSlotCount);
+  cell_of_.assign(capacity, kNone);
+  slot_of_.assign(capacity, kNone);
+  xs_.assign(capacity, 0.0);
+  ys_.assign(capacity, 0.0);
+  members_.resize(cell_count);
+  is_touched_.assign(cell_count, 0);
+}
+
+ConcurrentGridIndex::~ConcurrentGridIndex() {
+  for (std::size_t cell = 0; cell < columns_ * rows_; ++cell) {
+    delete cells_[cell].load(std::memory_order_relaxed);
+  }
+  for (const auto& [epoch, snapshot] : retired_) {
+    delete snapshot;
+  }
+}
+
+auto ConcurrentGridIndex::Update(const std::vector<PositionUpdate>& updates)
+    -> void {
+  GEOMETRY_INSTRUMENT_SCOPE(kConcurrentGridIndexUpdate);
+  for (const auto& update : updates) {
+    if (update.id >= cell_of_.size()) {
+      throw std::invalid_argument("Invalid input: Id out of range");
+    }
+    if (!std::isfinite(update.position.GetX()) ||
+        !std::isfinite(update.position.GetY())) {
+      throw std::invalid_argument("Invalid input: Non-finite coordinate");
+    }
+  }
+  const std::lock_guard<std::mutex> lock(writer_mutex_);
+  for (const auto& update : updates) {
+    const double x{update.position.GetX()};
+    const double y{update.position.GetY()};
+    xs_[update.id] = x;
+    ys_[update.id] = y;
+    MoveTo(update.id,
+           static_cast<uint32_t>((GetRow(y) * columns_) + GetColumn(x)));
+  }
+  Publish();
+}
+
+auto ConcurrentGridIndex::Remove(const std::vector<uint32_t>& ids) -> void {
+  GEOMETRY_INSTRUMENT_SCOPE(kConcurrentGridIndexUpdate);
+  for (const uint32_t id : ids) {
+    if (id >= cell_of_.size()) {
+      throw std::invalid_argument("Invalid input: Id out of range");
+    }
+  }
+  const std::lock_guard<std::mutex> lock(writer_mutex_);
+  for (const uint32_t id : ids) {
+    MoveTo(id, kNone);
+  }
+  Publish();
+}
+
+auto ConcurrentGridIndex::GetCellVersion(std::size_t column,
+                                         std::size_t row) const -> uint64_t {
+  const ReadGuard guard(*this);
+  const CellSnapshot* snapshot{
+      cells_[(row * columns_) + column].load(std::memory_order_seq_cst)};
+  return snapshot == nullptr ? 0 : snapshot->version;
+}
+
+auto ConcurrentGridIndex::EnterRead() const -> std::size_t {
+  // Start where this thread succeeded last time, which is almost always free.
+  thread_local std::size_t hint{
+      std::hash<std::thread::id>()(std::this_thread::get_id())};
+  for (std::size_t probe = 0; probe < kReaderSlotCount; ++probe) {
+    const std::size_t slot{(hint + probe) % kReaderSlotCount};
+    uint64_t expected{kIdle};
+    if (reader_slots_[slot].epoch.load(std::memory_order_relaxed) == kIdle &&
+        reader_slots_[slot].epoch.compare_exchange_strong(
+            expected, epoch_.load(std::memory_order_seq_cst),
+            std::memory_order_seq_cst)) {
+      hint = slot;
+      return slot;
+    }
+  }
+  // Every slot is taken: join the shared slot. The first reader announces
+  // its epoch, which is no later than that of any reader joining it.
+  uint64_t shared{shared_slot_.load(std::memory_order_seq_cst)};
+  for (;;) {
+    const uint64_t count{shared & kSharedCountMask};
+    const uint64_t epoch{
+        count == 0
+            ? epoch_.load(std::memory_order_seq_cst) << kSharedCountBits
+            : shared & ~kSharedCountMask};
+    if (shared_slot_.compare_exchange_weak(shared, epoch | (count + 1),
+                                           std::memory_order_seq_cst)) {
+      return kSharedSlot;
+    }
+  }
+}
+
+auto ConcurrentGridIndex::ExitRead(std::size_t slot) const -> void {
+  if (slot == kSharedSlot) {
+    shared_slot_.fetch_sub(1, std::memory_order_release);
+    return;
+  }
+  reader_slots_[slot].epoch.store(kIdle, std::memory_order_release);
+}
+
+auto ConcurrentGridIndex::MoveTo(uint32_t id, uint32_t cell) -> void {
+  const uint32_t old_cell{cell_of_[id]};
+  if (old_cell != kNone && is_touched_[old_cell] == 0) {
+    is_touched_[old_cell] = 1;
+    touched_.push_back(old_cell);
+  }
+  if (cell != kNone && is_touched_[cell] == 0) {
+    is_touched_[cell] = 1;
+    touched_.push_back(cell);
+  }
+  if (old_cell == cell) {
+    return;
+  }
+  if (old_cell != kNone) {
+    auto& members{members_[old_cell]};
+    const uint32_t moved{members.back()};
+    members[slot_of_[id]] = moved;
+    slot_of_[moved] = slot_of_[id];
+    members.pop_back();
+    size_.fetch_sub(1, std::memory_order_relaxed);
+  }
+  if (cell != kNone) {
+    slot_of_[id] = static_cast<uint32_t>(members_[cell].size());
+    members_[cell].push_back(id);
+    size_.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    slot_of_[id] = kNone;
+  }
+  cell_of_[id] = cell;
+}
+
+auto ConcurrentGridIndex::Publish() -> void {
+  if (touched_.empty()) {
+    return;
+  }
+  const std::size_t first_retired{retired_.size()};
+  for (const uint32_t cell : touched_) {
+    const CellSnapshot* old{cells_[cell].load(std::memory_order_relaxed)};
+    auto snapshot{std::make_unique<CellSnapshot>()};
+    snapshot->version = (old == nullptr) ? 1 : old->version + 1;
+    const auto& members{members_[cell]};
+    snapshot->ids = members;
+    snapshot->xs.reserve(members.size());
+    snapshot->ys.reserve(members.size());
+    for (const uint32_t id : members) {
+      snapshot->xs.push_back(xs_[id]);
+      snapshot->ys.push_back(ys_[id]);
+    }
+    cells_[cell].store(snapshot.release(), std::memory_order_seq_cst);
+    if (old != nullptr) {
+      retired_.emplace_back(0, old);
+    }
+    is_touched_[cell] = 0;
+  }
+  touched_.clear();
+
+  // Readers announcing an epoch after this increment load only the new
+  // snapshots, so the old ones wait for readers of this epoch or earlier.
+  const uint64_t epoch{epoch_.fetch_add(1, std::memory_order_seq_cst)};
+  for (std::size_t i = first_retired; i < retired_.size(); ++i) {
+    retired_[i].first = epoch;
+  }
+  Reclaim();
+}
+
+auto ConcurrentGridIndex::Reclaim() -> void {
+  uint64_t oldest{std::numeric_limits<uint64_t>::max()};
+  for (std::size_t slot = 0; slot < kReaderSlotCount; ++slot) {
+    const uint64_t epoch{
+        reader_slots_[slot].epoch.load(std::memory_order_seq_cst)};
+    if (epoch != kIdle) {
+      oldest = std::min(oldest, epoch);
+    }
+  }
+  const uint64_t shared{shared_slot_.load(std::memory_order_seq_cst)};
+  if ((shared & kSharedCountMask) != 0) {
+    // Only the low bits of the epoch are kept; it is the latest epoch with
+    // those bits that is not later than the current one.
+    const uint64_t current{epoch_.load(std::memory_order_seq_cst)};
+    const uint64_t age{(current - (shared >> kSharedCountBits)) &
+                       kSharedEpochMask};
+    oldest = std::min(oldest, current - age);
+  }
+  const auto end{std::partition(
+      retired_.begin(), retired_.end(),
+      [oldest](const auto& retired) { return retired.first >= oldest; })};
+  for (auto it = end; it != retired_.end(); ++it) {
+    delete it->second;
+  }
+  retired_.erase(end, retired_.end());
+}
+
+}  // namespace geometry
@@ -0,0 +1,123 @@
+/**
+ * @file geometry/cpu_dispatch.cpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Run time selection of CPU specific batch kernels
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/cpu_dispatch.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <stdexcept>
+#include <utility>
+
+#include "detail/kernel_dispatch.hpp"
+
+namespace {
+// Advanced SIMD is part of the AArch64 base architecture, so the baseline
+// build already is the NEON path there.
+#if defined(__aarch64__) || defined(_M_ARM64)
+constexpr geometry::KernelPath kBaselinePath{geometry::KernelPath::kNeon};
+#else
+constexpr geometry::KernelPath kBaselinePath{geometry::KernelPath::kScalar};
+#endif
+
+constexpr std::array<std::pair<geometry::KernelPath, std::string_view>, 4>
+    kPathNames{{{geometry::KernelPath::kScalar, "scalar"},
+                {geometry::KernelPath::kNeon, "neon"},
+                {geometry::KernelPath::kAvx2, "avx2"},
+                {geometry::KernelPath::kAvx512, "avx512"}}};
+
+auto IsAvailable(geometry::KernelPath path) -> bool {
+  if (path == kBaselinePath) {
+    return true;
+  }
+#if defined(GEOMETRY_X86_KERNELS)
+  // Also checks that the operating system saves the AVX register state.
+  __builtin_cpu_init();
+  const bool avx2{__builtin_cpu_supports("avx2") &&
+                  __builtin_cpu_supports("fma") &&
+                  __builtin_cpu_supports("bmi") &&
+                  __builtin_cpu_supports("bmi2")};
+  if (path == geometry::KernelPath::kAvx2) {
+    return avx2;
+  }
+  if (path == geometry::KernelPath::kAvx512) {
+    return avx2 && __builtin_cpu_supports("avx512f") &&
+           __builtin_cpu_supports("avx512vl") &&
+           __builtin_cpu_supports("avx512dq") &&
+           __builtin_cpu_supports("avx512bw");
+  }
+#endif
+  return false;
+}
+
+auto SelectInitialPath() -> geometry::KernelPath {
+#if defined(_MSC_VER)
+#pragma warning(suppress : 4996)
+#endif
+  const char* forced{std::getenv(geometry::kKernelPathVariable.data())};
+  geometry::KernelPath path{kBaselinePath};
+  if (forced != nullptr && geometry::ParseKernelPath(forced, path) &&
+      IsAvailable(path)) {
+    return path;
+  }
+  return geometry::GetAvailableKernelPaths().back();
+}
+
+auto BoundPath() -> std::atomic<geometry::KernelPath>& {
+  static std::atomic<geometry::KernelPath> path{SelectInitialPath()};
+  return path;
+}
+}  // namespace
+
+namespace geometry {
+
+auto GetKernelPath() -> KernelPath {
+  return BoundPath().load(std::memory_order_relaxed);
+}
+
+auto SetKernelPath(KernelPath path) -> void {
+  if (!IsAvailable(path)) {
+    throw std::invalid_argument("Invalid input: Kernel path not available");
+  }
+  BoundPath().store(path, std::memory_order_relaxed);
+}
+
+auto GetAvailableKernelPaths() -> std::vector<KernelPath> {
+  std::vector<KernelPath> paths;
+  for (const auto& [path, name] : kPathNames) {
+    if (IsAvailable(path)) {
+      paths.push_back(path);
+    }
+  }
+  return paths;
+}
+
+auto GetKernelPathName(KernelPath path) -> std::string_view {
+  for (const auto& [known, name] : kPathNames) {
+    if (known == path) {
+      return name;
+    }
+  }
+  throw std::invalid_argument("Invalid input: Unknown kernel path");
+}
+
+auto ParseKernelPath(std::string_view name, KernelPath& path) -> bool {
+  for (const auto& [known, known_name] : kPathNames) {
+    if (known_name == name) {
+      path = known;
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace geometry
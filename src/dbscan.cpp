@@ -0,0 +1,217 @@
+/**
+ * @file geometry/dbscan.cpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Parallel grid-based DBSCAN clustering over Point2D sets
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/dbscan.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "detail/parallel.hpp"
+#include "geometry/grid_index.hpp"
+#include "geometry/instrumentation.hpp"
+
+namespace {
+constexpr std::size_t kGrain{4096U};
+constexpr uint32_t kNone{std::numeric_limits<uint32_t>::max()};
+constexpr double kSqrt2{1.4142135623730951};
+
+/**
+ * @brief Lock-free disjoint set. Roots are always linked below the smaller
+ * root, so concurrent unions cannot form cycles.
+ */
+class DisjointSet {
+ public:
+  explicit DisjointSet(std::size_t count) : parent_(count) {
+    for (std::size_t i = 0; i < count; ++i) {
+      parent_[i].store(static_cast<uint32_t>(i), std::memory_order_relaxed);
+    }
+  }
+
+  auto Find(uint32_t element) -> uint32_t {
+    for (;;) {
+      uint32_t parent{parent_[element].load(std::memory_order_acquire)};
+      if (parent == element) {
+        return element;
+      }
+      const uint32_t grand{parent_[parent].load(std::memory_order_acquire)};
+      if (grand != parent) {
+        // Path halving, losing the race only skips the shortcut.
+        parent_[element].compare_exchange_weak(parent, grand,
+                                               std::memory_order_release,
+                                               std::memory_order_relaxed);
+      }
+      element = grand;
+    }
+  }
+
+  auto Unite(uint32_t lhs, uint32_t rhs) -> void {
+    for (;;) {
+      lhs = Find(lhs);
+      rhs = Find(rhs);
+      if (lhs == rhs) {
+        return;
+      }
+      if (lhs < rhs) {
+        std::swap(lhs, rhs);
+      }
+      uint32_t expected{lhs};
+      if (parent_[lhs].compare_exchange_strong(expected, rhs,
+                                               std::memory_order_acq_rel)) {
+        return;
+      }
+    }
+  }
+
+ private:
+  std::vector<std::atomic<uint32_t>> parent_;
+};
+
+/**
+ * @brief Visit the slots within eps of a slot until the visitor returns false.
+ */
+template <typename Visitor>
+auto ForEachNeighbour(const geometry::GridIndex& grid, std::size_t slot,
+                      double eps, Visitor&& visitor) -> void {
+  const auto& xs{grid.GetXs()};
+  const auto& ys{grid.GetYs()};
+  const double x{xs[slot]};
+  const double y{ys[slot]};
+  const double squared_eps{eps * eps};
+  const std::size_t first_column{grid.GetColumn(x - eps)};
+  const std::size_t last_column{grid.GetColumn(x + eps)};
+  const std::size_t last_row{grid.GetRow(y + eps)};
+  for (std::size_t row = grid.GetRow(y - eps); row <= last_row; ++row) {
+    const std::size_t end{grid.GetCellEnd(last_column, row)};
+    for (std::size_t other = grid.GetCellBegin(first_column, row); other < end;
+         ++other) {
+      const double dx{xs[other] - x};
+      const double dy{ys[other] - y};
+      const double squared{(dx * dx) + (dy * dy)};
+      if (squared <= squared_eps && !visitor(other, squared)) {
+        return;
+      }
+    }
+  }
+}
+}  // namespace
+
+namespace geometry {
+
+auto Dbscan(const std::vector<Point2D>& points, const DbscanOptions& options)
+    -> DbscanResult {
+  GEOMETRY_INSTRUMENT_SCOPE(kDbscan);
+  const double eps{options.eps.GetValue(Distance::Type::kMeter)};
+  if (!(eps > 0.0)) {
+    throw std::invalid_argument("Invalid input: eps must be positive");
+  }
+
+  const std::size_t count{points.size()};
+  DbscanResult result;
+  result.labels.assign(count, DbscanResult::kNoise);
+  result.is_core.assign(count, 0);
+  if (count == 0) {
+    return result;
+  }
+
+  // Cells with a diagonal of eps hold mutual neighbours only, so a cell with
+  // at least min_points points is all core without a neighbour scan.
+  const GridIndex grid(points, Distance(eps / kSqrt2, Distance::Type::kMeter));
+  const bool dense_cells{grid.GetCellSize() * kSqrt2 <= eps};
+  const std::size_t min_points{options.min_points};
+  const auto& indices{grid.GetIndices()};
+
+  std::vector<uint8_t> is_core(count, 0);
+  detail::ParallelFor(
+      count, kGrain, options.thread_count,
+      [&](std::size_t begin, std::size_t end, std::size_t /*worker*/) {
+        for (std::size_t slot = begin; slot < end; ++slot) {
+          if (dense_cells) {
+            const std::size_t column{grid.GetColumn(grid.GetXs()[slot])};
+            const std::size_t row{grid.GetRow(grid.GetYs()[slot])};
+            if (grid.GetCellEnd(column, row) - grid.GetCellBegin(column, row) >=
+                min_points) {
+              is_core[slot] = 1;
+              continue;
+            }
+          }
+          std::size_t neighbours{0};
+          ForEachNeighbour(grid, slot, eps, [&](std::size_t, double) {
+            return ++neighbours < min_points;
+          });
+          is_core[slot] = (neighbours >= min_points) ? 1 : 0;
+        }
+      });
+
+  DisjointSet clusters(count);
+  detail::ParallelFor(
+      count, kGrain, options.thread_count,
+      [&](std::size_t begin, std::size_t end, std::size_t /*worker*/) {
+        for (std::size_t slot = begin; slot < end; ++slot) {
+          if (is_core[slot] == 0) {
+            continue;
+          }
+          ForEachNeighbour(grid, slot, eps, [&](std::size_t other, double) {
+            if (other > slot && is_core[other] != 0) {
+              clusters.Unite(static_cast<uint32_t>(slot),
+                             static_cast<uint32_t>(other));
+            }
+            return true;
+          });
+        }
+      });
+
+  // Border points follow their nearest core point.
+  std::vector<uint32_t> owner(count, kNone);
+  detail::ParallelFor(
+      count, kGrain, options.thread_count,
+      [&](std::size_t begin, std::size_t end, std::size_t /*worker*/) {
+        for (std::size_t slot = begin; slot < end; ++slot) {
+          if (is_core[slot] != 0) {
+            owner[slot] = static_cast<uint32_t>(slot);
+            continue;
+          }
+          double nearest{std::numeric_limits<double>::infinity()};
+          ForEachNeighbour(grid, slot, eps,
+                           [&](std::size_t other, double squared) {
+                             if (is_core[other] != 0 && squared < nearest) {
+                               nearest = squared;
+                               owner[slot] = static_cast<uint32_t>(other);
+                             }
+                             return true;
+                           });
+        }
+      });
+
+  std::vector<uint32_t> slot_of(count);
+  for (std::size_t slot = 0; slot < count; ++slot) {
+    slot_of[indices[slot]] = static_cast<uint32_t>(slot);
+  }
+  std::vector<int32_t> root_label(count, DbscanResult::kNoise);
+  for (std::size_t i = 0; i < count; ++i) {
+    const uint32_t slot{slot_of[i]};
+    result.is_core[i] = is_core[slot];
+    if (owner[slot] == kNone) {
+      continue;
+    }
+    const uint32_t root{clusters.Find(owner[slot])};
+    if (root_label[root] == DbscanResult::kNoise) {
+      root_label[root] = static_cast<int32_t>(result.cluster_count++);
+    }
+    result.labels[i] = root_label[root];
+  }
+  return result;
+}
+
+}  // namespace geometry
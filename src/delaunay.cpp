@@ -0,0 +1,616 @@
+/**
+ * @file geometry/delaunay.cpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Incremental Delaunay triangulation and dual Voronoi diagram
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/delaunay.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <utility>
+
+#include "detail/radix_sort.hpp"
+#include "geometry/instrumentation.hpp"
+#include "geometry/predicates.hpp"
+#include "geometry/space_filling_curve.hpp"
+
+namespace {
+constexpr uint32_t kNone{geometry::DelaunayTriangulation::kInvalidIndex};
+constexpr uint32_t kInfinite{kNone - 1};  // Vertex of every ghost triangle
+constexpr uint32_t kIndexBits{30};
+constexpr std::size_t kMaxPointCount{std::size_t{1} << kIndexBits};
+constexpr uint32_t kHilbertOrder{13};  // Bits per axis of the sort key
+constexpr uint32_t kKeyShift{32 - kHilbertOrder};
+constexpr uint32_t kMaxRound{31};  // Fits the 8 bits left above key and index
+constexpr uint64_t kOrderSeed{0xB210U};
+constexpr std::size_t kFirstRoundSize{64};
+
+inline auto Next(uint32_t edge) -> uint32_t {
+  return (edge % 3 == 2) ? edge - 2 : edge + 1;
+}
+
+inline auto Previous(uint32_t edge) -> uint32_t {
+  return (edge % 3 == 0) ? edge + 2 : edge - 1;
+}
+
+/**
+ * @brief Level of a point in the randomized insertion order, 0 for about half
+ * of the points, 1 for a quarter and so on.
+ */
+auto RandomLevel(uint32_t index) -> uint32_t {
+  uint64_t hash{(index + kOrderSeed) * 0x9E3779B97F4A7C15ULL};
+  hash = (hash ^ (hash >> 31U)) * 0xBF58476D1CE4E5B9ULL;
+  hash ^= hash >> 29U;
+  uint32_t level{0};
+  while ((hash & 1U) != 0 && level < kMaxRound) {
+    hash >>= 1U;
+    ++level;
+  }
+  return level;
+}
+
+/**
+ * @brief Biased randomized insertion order: every point draws a random
+ * level, rounds run from the highest level to level 0 so that each round
+ * roughly doubles the inserted set, and every round is sorted along a Hilbert
+ * curve. Later rounds refine earlier ones, so point location walks stay short
+ * while the randomness keeps the expected cavity size constant. One packed
+ * word of round, key and index is radix sorted.
+ */
+auto MakeInsertionOrder(const std::vector<double>& xs,
+                        const std::vector<double>& ys)
+    -> std::vector<uint32_t> {
+  const std::size_t count{xs.size()};
+  const auto [min_x, max_x] = std::minmax_element(xs.begin(), xs.end());
+  const auto [min_y, max_y] = std::minmax_element(ys.begin(), ys.end());
+  const double extent{std::max({*max_x - *min_x, *max_y - *min_y, 1e-300})};
+  const double scale{static_cast<double>((1U << kHilbertOrder) - 1) / extent};
+
+  // Levels at or above top form the first round of about kFirstRoundSize.
+  uint32_t top{0};
+  while (top < kMaxRound && (count >> (top + 1)) >= kFirstRoundSize) {
+    ++top;
+  }
+  std::vector<uint64_t> packed(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto index{static_cast<uint32_t>(i)};
+    const uint64_t round{top - std::min(top, RandomLevel(index))};
+    // The top levels of the full Hilbert curve, of order kHilbertOrder.
+    const uint64_t key{
+        geometry::EncodeHilbert(
+            static_cast<uint32_t>((xs[i] - *min_x) * scale) << kKeyShift,
+            static_cast<uint32_t>((ys[i] - *min_y) * scale) << kKeyShift) >>
+        (2 * kKeyShift)};
+    packed[i] = (round << (2 * kHilbertOrder + kIndexBits)) |
+                (key << kIndexBits) | index;
+  }
+  geometry::detail::RadixSort(packed, 1);
+  std::vector<uint32_t> order(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    order[i] = static_cast<uint32_t>(packed[i] & ((1ULL << kIndexBits) - 1));
+  }
+  return order;
+}
+
+/**
+ * @brief Bowyer-Watson insertion over a half-edge array. The hull is closed
+ * by ghost triangles sharing the vertex kInfinite, so a point outside the
+ * hull is inserted exactly like a point inside. Cavity triangles are reused
+ * for the new triangles, and the arrays only ever grow by two triangles per
+ * inserted point. Vertices are renumbered in insertion order, so coordinates
+ * are read in the same spatially coherent order as the triangles.
+ */
+class Builder {
+ public:
+  explicit Builder(const std::vector<geometry::Point2D>& points) {
+    std::vector<double> xs(points.size());
+    std::vector<double> ys(points.size());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      xs[i] = points[i].GetX();
+      ys[i] = points[i].GetY();
+      if (!std::isfinite(xs[i]) || !std::isfinite(ys[i])) {
+        throw std::invalid_argument("Invalid input: Non-finite coordinate");
+      }
+    }
+    if (points.empty()) {
+      return;
+    }
+    order_ = MakeInsertionOrder(xs, ys);
+    xs_.resize(points.size());
+    ys_.resize(points.size());
+    for (std::size_t i = 0; i < order_.size(); ++i) {
+      xs_[i] = xs[order_[i]];
+      ys_[i] = ys[order_[i]];
+    }
+  }
+
+  auto Run() -> void {
+    if (xs_.size() < 3 || !Seed()) {
+      return;
+    }
+    const std::size_t reserve{2 * xs_.size() + 8};
+    triangles_.reserve(3 * reserve);
+    half_edges_.reserve(3 * reserve);
+    marks_.reserve(reserve);
+    // Points skipped while seeding are retried in insertion order.
+    for (uint32_t vertex = 1; vertex < xs_.size(); ++vertex) {
+      if (!inserted_[vertex]) {
+        Insert(vertex);
+      }
+    }
+  }
+
+  /**
+   * @brief Move the real triangles out, dropping ghosts and renumbering.
+   */
+  auto Finish(std::vector<uint32_t>& triangles,
+              std::vector<uint32_t>& half_edges) -> void {
+    const std::size_t count{marks_.size()};
+    std::vector<uint32_t> remap(count, kNone);
+    uint32_t real{0};
+    for (std::size_t t = 0; t < count; ++t) {
+      if (IsReal(static_cast<uint32_t>(t))) {
+        remap[t] = real++;
+      }
+    }
+    triangles.resize(3 * std::size_t{real});
+    half_edges.resize(3 * std::size_t{real});
+    for (std::size_t t = 0; t < count; ++t) {
+      if (remap[t] == kNone) {
+        continue;
+      }
+      for (uint32_t i = 0; i < 3; ++i) {
+        const uint32_t edge{static_cast<uint32_t>((3 * t) + i)};
+        const uint32_t twin{half_edges_[edge]};
+        const uint32_t target{(3 * remap[t]) + i};
+        triangles[target] = order_[triangles_[edge]];
+        half_edges[target] = (remap[twin / 3] == kNone)
+                                 ? kNone
+                                 : (3 * remap[twin / 3]) + (twin % 3);
+      }
+    }
+  }
+
+ private:
+  [[nodiscard]] auto IsReal(uint32_t triangle) const -> bool {
+    const uint32_t base{3 * triangle};
+    return marks_[triangle] != kDead && triangles_[base] != kInfinite &&
+           triangles_[base + 1] != kInfinite &&
+           triangles_[base + 2] != kInfinite;
+  }
+
+  [[nodiscard]] auto Orient(uint32_t a, uint32_t b, uint32_t c) const
+      -> double {
+    return geometry::Orient2D(xs_[a], ys_[a], xs_[b], ys_[b], xs_[c], ys_[c]);
+  }
+
+  [[nodiscard]] auto InCircle(uint32_t a, uint32_t b, uint32_t c,
+                              uint32_t d) const -> double {
+    return geometry::InCircle(xs_[a], ys_[a], xs_[b], ys_[b], xs_[c], ys_[c],
+                              xs_[d], ys_[d]);
+  }
+
+  /**
+   * @brief Whether vertex lies strictly inside the circumcircle of a triangle.
+   * The circumcircle of a ghost triangle degenerates to the open half-plane
+   * beyond its hull edge plus the open hull edge itself.
+   */
+  [[nodiscard]] auto InConflict(uint32_t triangle, uint32_t vertex) const
+      -> bool {
+    const uint32_t base{3 * triangle};
+    for (uint32_t i = 0; i < 3; ++i) {
+      if (triangles_[base + i] != kInfinite) {
+        continue;
+      }
+      const uint32_t p{triangles_[base + ((i + 1) % 3)]};
+      const uint32_t q{triangles_[base + ((i + 2) % 3)]};
+      const double side{Orient(p, q, vertex)};
+      if (side != 0.0) {
+        return side > 0.0;
+      }
+      const double dot{((xs_[vertex] - xs_[p]) * (xs_[q] - xs_[vertex])) +
+                       ((ys_[vertex] - ys_[p]) * (ys_[q] - ys_[vertex]))};
+      return dot > 0.0;
+    }
+    return InCircle(triangles_[base], triangles_[base + 1],
+                    triangles_[base + 2], vertex) > 0.0;
+  }
+
+  auto AddTriangle(uint32_t a, uint32_t b, uint32_t c) -> uint32_t {
+    const auto triangle{static_cast<uint32_t>(marks_.size())};
+    triangles_.insert(triangles_.end(), {a, b, c});
+    half_edges_.insert(half_edges_.end(), {kNone, kNone, kNone});
+    marks_.push_back(0);
+    return triangle;
+  }
+
+  auto Link(uint32_t lhs, uint32_t rhs) -> void {
+    half_edges_[lhs] = rhs;
+    half_edges_[rhs] = lhs;
+  }
+
+  /**
+   * @brief Create the first triangle and its three ghosts from the first
+   * three non-collinear points of the insertion order.
+   */
+  auto Seed() -> bool {
+    const auto count{static_cast<uint32_t>(xs_.size())};
+    inserted_.assign(count, false);
+    const uint32_t a{0};
+    uint32_t b{1};
+    while (b < count && xs_[b] == xs_[a] && ys_[b] == ys_[a]) {
+      ++b;
+    }
+    uint32_t c{b + 1};
+    while (c < count && Orient(a, b, c) == 0.0) {
+      ++c;
+    }
+    if (c >= count) {
+      return false;
+    }
+    if (Orient(a, b, c) < 0.0) {
+      std::swap(b, c);
+    }
+    const uint32_t real{AddTriangle(a, b, c)};
+    const uint32_t ghost_ab{AddTriangle(b, a, kInfinite)};
+    const uint32_t ghost_bc{AddTriangle(c, b, kInfinite)};
+    const uint32_t ghost_ca{AddTriangle(a, c, kInfinite)};
+    Link(3 * real, 3 * ghost_ab);
+    Link((3 * real) + 1, 3 * ghost_bc);
+    Link((3 * real) + 2, 3 * ghost_ca);
+    Link((3 * ghost_ab) + 1, (3 * ghost_ca) + 2);
+    Link((3 * ghost_bc) + 1, (3 * ghost_ab) + 2);
+    Link((3 * ghost_ca) + 1, (3 * ghost_bc) + 2);
+    inserted_[a] = inserted_[b] = inserted_[c] = true;
+    last_ = real;
+    return true;
+  }
+
+  /**
+   * @brief Walk from the last created triangle towards vertex. Returns the
+   * real triangle containing it, or a ghost triangle whose hull edge sees it.
+   */
+  auto Locate(uint32_t vertex) -> uint32_t {
+    uint32_t triangle{last_};
+    const std::size_t limit{(4 * marks_.size()) + 16};
+    for (std::size_t step = 0; step < limit; ++step) {
+      const uint32_t base{3 * triangle};
+      if (!IsReal(triangle)) {
+        return triangle;
+      }
+      // Randomizing the first edge tried rules out cycles on degenerate input.
+      walk_state_ = (walk_state_ * 1103515245U) + 12345U;
+      const uint32_t start{(walk_state_ >> 16U) % 3};
+      bool moved{false};
+      for (uint32_t i = 0; i < 3 && !moved; ++i) {
+        const uint32_t edge{base + ((start + i) % 3)};
+        if (Orient(triangles_[edge], triangles_[Next(edge)], vertex) < 0.0) {
+          triangle = half_edges_[edge] / 3;
+          moved = true;
+        }
+      }
+      if (!moved) {
+        return triangle;
+      }
+    }
+    const uint32_t conflict{FindConflict(vertex)};
+    return conflict == kNone ? last_ : conflict;
+  }
+
+  /**
+   * @brief Scan for any triangle in conflict with vertex, a safety net should
+   * the walk stop short.
+   */
+  [[nodiscard]] auto FindConflict(uint32_t vertex) const -> uint32_t {
+    for (uint32_t t = 0; t < marks_.size(); ++t) {
+      if (marks_[t] != kDead && InConflict(t, vertex)) {
+        return t;
+      }
+    }
+    return kNone;
+  }
+
+  [[nodiscard]] auto IsDuplicate(uint32_t triangle, uint32_t vertex) const
+      -> bool {
+    for (uint32_t i = 0; i < 3; ++i) {
+      const uint32_t other{triangles_[(3 * triangle) + i]};
+      if (other != kInfinite && xs_[other] == xs_[vertex] &&
+          ys_[other] == ys_[vertex]) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  auto Insert(uint32_t vertex) -> void {
+    uint32_t seed{Locate(vertex)};
+    if (!InConflict(seed, vertex)) {
+      // With exact predicates only a duplicate of a vertex of the located
+      // triangle is on no circumcircle; the scan is a safety net.
+      if (IsDuplicate(seed, vertex)) {
+        return;
+      }
+      seed = FindConflict(vertex);
+      if (seed == kNone) {
+        return;
+      }
+    }
+
+    // Grow the cavity of triangles whose circumcircle contains the vertex.
+    ++stamp_;
+    if (stamp_ == kDead) {
+      std::replace_if(
+          marks_.begin(), marks_.end(),
+          [](uint32_t mark) { return mark != kDead; }, 0U);
+      stamp_ = 1;
+    }
+    cavity_.clear();
+    boundary_.clear();
+    marks_[seed] = stamp_;
+    cavity_.push_back(seed);
+    for (std::size_t at = 0; at < cavity_.size(); ++at) {
+      const uint32_t base{3 * cavity_[at]};
+      for (uint32_t i = 0; i < 3; ++i) {
+        const uint32_t twin{half_edges_[base + i]};
+        const uint32_t neighbour{twin / 3};
+        if (marks_[neighbour] == stamp_) {
+          continue;
+        }
+        if (InConflict(neighbour, vertex)) {
+          marks_[neighbour] = stamp_;
+          cavity_.push_back(neighbour);
+        } else {
+          boundary_.push_back({triangles_[base + i],
+                               triangles_[Next(base + i)], twin, kNone});
+        }
+      }
+    }
+
+    // Fan the boundary to the vertex, reusing the cavity triangles first.
+    for (std::size_t i = 0; i < boundary_.size(); ++i) {
+      Boundary& edge{boundary_[i]};
+      uint32_t triangle{0};
+      if (i < cavity_.size()) {
+        triangle = cavity_[i];
+        const uint32_t base{3 * triangle};
+        triangles_[base] = edge.from;
+        triangles_[base + 1] = edge.to;
+        triangles_[base + 2] = vertex;
+      } else {
+        triangle = AddTriangle(edge.from, edge.to, vertex);
+      }
+      marks_[triangle] = 0;
+      Link(3 * triangle, edge.outside);
+      edge.triangle = triangle;
+      if (edge.from != kInfinite && edge.to != kInfinite) {
+        last_ = triangle;
+      }
+    }
+    // Around the new vertex, the edge to->vertex of the triangle on boundary
+    // edge from->to is the twin of vertex->to of the triangle starting at to.
+    for (const Boundary& edge : boundary_) {
+      for (const Boundary& other : boundary_) {
+        if (other.from == edge.to) {
+          Link((3 * edge.triangle) + 1, (3 * other.triangle) + 2);
+          break;
+        }
+      }
+    }
+    // Fewer boundary edges than cavity triangles cannot occur in exact
+    // arithmetic; retire any surplus so it is never walked into.
+    for (std::size_t i = boundary_.size(); i < cavity_.size(); ++i) {
+      marks_[cavity_[i]] = kDead;
+    }
+    inserted_[vertex] = true;
+  }
+
+  struct Boundary {
+    uint32_t from;
+    uint32_t to;
+    uint32_t outside;
+    uint32_t triangle;
+  };
+
+  static constexpr uint32_t kDead{std::numeric_limits<uint32_t>::max()};
+
+  std::vector<uint32_t> order_;  // Input index of every vertex
+  std::vector<double> xs_;
+  std::vector<double> ys_;
+  std::vector<uint32_t> triangles_;
+  std::vector<uint32_t> half_edges_;
+  std::vector<uint32_t> marks_;  // Cavity stamp of every triangle or kDead
+  std::vector<bool> inserted_;
+  std::vector<uint32_t> cavity_;
+  std::vector<Boundary> boundary_;
+  uint32_t stamp_{0};
+  uint32_t last_{0};
+  uint32_t walk_state_{1};
+};
+
+auto Circumcenter(const geometry::Point2D& a, const geometry::Point2D& b,
+                  const geometry::Point2D& c) -> geometry::Point2D {
+  const double bx{b.GetX() - a.GetX()};
+  const double by{b.GetY() - a.GetY()};
+  const double cx{c.GetX() - a.GetX()};
+  const double cy{c.GetY() - a.GetY()};
+  const double b_lift{(bx * bx) + (by * by)};
+  const double c_lift{(cx * cx) + (cy * cy)};
+  const double scale{0.5 / ((bx * cy) - (by * cx))};
+  const double ux{((cy * b_lift) - (by * c_lift)) * scale};
+  const double uy{((bx * c_lift) - (cx * b_lift)) * scale};
+  return geometry::Point2D(a.GetX() + ux, a.GetY() + uy);
+}
+
+/**
+ * @brief Keep the part of a polygon where normal . p <= offset.
+ */
+auto ClipPolygon(const std::vector<geometry::Point2D>& polygon, double nx,
+                 double ny, double offset) -> std::vector<geometry::Point2D> {
+  std::vector<geometry::Point2D> clipped;
+  clipped.reserve(polygon.size() + 1);
+  for (std::size_t i = 0; i < polygon.size(); ++i) {
+    const geometry::Point2D& from{polygon[i]};
+    const geometry::Point2D& to{polygon[(i + 1) % polygon.size()]};
+    const double from_side{(nx * from.GetX()) + (ny * from.GetY()) - offset};
+    const double to_side{(nx * to.GetX()) + (ny * to.GetY()) - offset};
+    if (from_side <= 0.0) {
+      clipped.push_back(from);
+    }
+    if ((from_side < 0.0 && to_side > 0.0) ||
+        (from_side > 0.0 && to_side < 0.0)) {
+      const double t{from_side / (from_side - to_side)};
+      clipped.emplace_back(from.GetX() + (t * (to.GetX() - from.GetX())),
+                           from.GetY() + (t * (to.GetY() - from.GetY())));
+    }
+  }
+  return clipped;
+}
+}  // namespace
+
+namespace geometry {
+
+DelaunayTriangulation::DelaunayTriangulation(
+    const std::vector<Point2D>& points)
+    : points_(points) {
+  GEOMETRY_INSTRUMENT_SCOPE(kDelaunay);
+  if (points.size() > kMaxPointCount) {
+    throw std::invalid_argument("Invalid input: Too many points");
+  }
+  Builder builder(points);
+  builder.Run();
+  builder.Finish(triangles_, half_edges_);
+
+  // Prefer the hull half-edge ending at a hull vertex, so that walking the
+  // triangles around it from there visits all of them.
+  incoming_.assign(points.size(), kNone);
+  std::vector<uint32_t> hull_next(points.size(), kNone);
+  for (uint32_t edge = 0; edge < triangles_.size(); ++edge) {
+    const uint32_t to{triangles_[Next(edge)]};
+    if (incoming_[to] == kNone || half_edges_[edge] == kNone) {
+      incoming_[to] = edge;
+    }
+    if (half_edges_[edge] == kNone) {
+      hull_next[triangles_[edge]] = to;
+    }
+  }
+  if (triangles_.empty()) {
+    return;
+  }
+  uint32_t start{kNone};
+  for (uint32_t edge = 0; edge < half_edges_.size() && start == kNone;
+       ++edge) {
+    if (half_edges_[edge] == kNone) {
+      start = triangles_[edge];
+    }
+  }
+  uint32_t vertex{start};
+  do {
+    hull_.push_back(vertex);
+    vertex = hull_next[vertex];
+  } while (vertex != start && vertex != kNone);
+}
+
+template <typename Visitor>
+auto DelaunayTriangulation::ForEachIncoming(uint32_t vertex,
+                                            Visitor&& visitor) const -> bool {
+  const uint32_t start{incoming_[vertex]};
+  uint32_t edge{start};
+  do {
+    visitor(edge);
+    edge = half_edges_[Next(edge)];
+  } while (edge != kNone && edge != start);
+  return edge == kNone;
+}
+
+auto DelaunayTriangulation::GetNeighbours(uint32_t vertex) const
+    -> std::vector<uint32_t> {
+  std::vector<uint32_t> neighbours;
+  if (vertex >= incoming_.size() || incoming_[vertex] == kNone) {
+    return neighbours;
+  }
+  uint32_t last_edge{kNone};
+  const bool open{ForEachIncoming(vertex, [&](uint32_t edge) {
+    neighbours.push_back(triangles_[edge]);
+    last_edge = edge;
+  })};
+  if (open) {
+    neighbours.push_back(triangles_[Previous(last_edge)]);
+  }
+  std::reverse(neighbours.begin(), neighbours.end());
+  return neighbours;
+}
+
+auto DelaunayTriangulation::ComputeVoronoi() const -> VoronoiDiagram {
+  GEOMETRY_INSTRUMENT_SCOPE(kDelaunay);
+  VoronoiDiagram diagram;
+  const std::size_t triangle_count{GetTriangleCount()};
+  diagram.vertices.reserve(triangle_count);
+  for (std::size_t t = 0; t < triangle_count; ++t) {
+    diagram.vertices.push_back(Circumcenter(points_[triangles_[3 * t]],
+                                            points_[triangles_[(3 * t) + 1]],
+                                            points_[triangles_[(3 * t) + 2]]));
+  }
+  diagram.cell_offsets.reserve(points_.size() + 1);
+  diagram.cell_offsets.push_back(0);
+  diagram.cell_vertices.reserve(triangles_.size());
+  diagram.is_unbounded.assign(points_.size(), 0);
+  for (uint32_t vertex = 0; vertex < points_.size(); ++vertex) {
+    if (incoming_[vertex] != kNone) {
+      const auto begin{diagram.cell_vertices.end() -
+                       diagram.cell_vertices.begin()};
+      const bool open{ForEachIncoming(vertex, [&](uint32_t edge) {
+        diagram.cell_vertices.push_back(edge / 3);
+      })};
+      std::reverse(diagram.cell_vertices.begin() + begin,
+                   diagram.cell_vertices.end());
+      diagram.is_unbounded[vertex] = open ? 1 : 0;
+    }
+    diagram.cell_offsets.push_back(
+        static_cast<uint32_t>(diagram.cell_vertices.size()));
+  }
+  return diagram;
+}
+
+auto DelaunayTriangulation::ClipVoronoiCell(uint32_t vertex,
+                                            const Point2D& min_corner,
+                                            const Point2D& max_corner) const
+    -> std::vector<Point2D> {
+  if (vertex >= incoming_.size() || incoming_[vertex] == kNone) {
+    return {};
+  }
+  std::vector<Point2D> polygon{{min_corner.GetX(), min_corner.GetY()},
+                               {max_corner.GetX(), min_corner.GetY()},
+                               {max_corner.GetX(), max_corner.GetY()},
+                               {min_corner.GetX(), max_corner.GetY()}};
+  const Point2D& site{points_[vertex]};
+  const double site_lift{(site.GetX() * site.GetX()) +
+                         (site.GetY() * site.GetY())};
+  for (const uint32_t neighbour : GetNeighbours(vertex)) {
+    if (polygon.empty()) {
+      break;
+    }
+    // Points closer to the site than to the neighbour: the bisector side.
+    const Point2D& other{points_[neighbour]};
+    const double other_lift{(other.GetX() * other.GetX()) +
+                            (other.GetY() * other.GetY())};
+    polygon = ClipPolygon(polygon, other.GetX() - site.GetX(),
+                          other.GetY() - site.GetY(),
+                          0.5 * (other_lift - site_lift));
+  }
+  return polygon;
+}
+
+}  // namespace geometry
@@ -0,0 +1,66 @@
+/**
+ * @file geometry/detail/arc_length.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Internal exact arc lengths in whole nanometers
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__DETAIL__ARC_LENGTH_HPP_
+#define GEOMETRY__DETAIL__ARC_LENGTH_HPP_
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+#include "geometry/point2d.hpp"
+
+namespace geometry {
+namespace detail {
+
+// Segment lengths are rounded to whole nanometers, so that arc lengths add up
+// exactly however many segments they span.
+constexpr double kMeterToNanometer{1.0e9};
+constexpr double kMaxSegmentLength{9.0e9};  // Meters, inside int64_t nm
+constexpr int64_t kMaxArcLength{std::numeric_limits<int64_t>::max()};
+
+inline auto CheckFinite(const Point2D& point) -> void {
+  if (!std::isfinite(point.GetX()) || !std::isfinite(point.GetY())) {
+    throw std::invalid_argument("Invalid input: Coordinate not finite");
+  }
+}
+
+/**
+ * @brief Length of a segment in whole nanometers.
+ */
+inline auto SegmentLength(const Point2D& from, const Point2D& to) -> int64_t {
+  const double dx{to.GetX() - from.GetX()};
+  const double dy{to.GetY() - from.GetY()};
+  const double length{std::sqrt((dx * dx) + (dy * dy))};
+  if (!(length <= kMaxSegmentLength)) {
+    throw std::invalid_argument(std::isfinite(length)
+                                    ? "Invalid input: Sequence too long"
+                                    : "Invalid input: Coordinate not finite");
+  }
+  return std::llround(length * kMeterToNanometer);
+}
+
+/**
+ * @brief Arc length start + length, checked against the Distance range.
+ */
+inline auto AddLength(int64_t start, int64_t length) -> int64_t {
+  if (length > kMaxArcLength - start) {
+    throw std::invalid_argument("Invalid input: Sequence too long");
+  }
+  return start + length;
+}
+
+}  // namespace detail
+}  // namespace geometry
+
+#endif  // GEOMETRY__DETAIL__ARC_LENGTH_HPP_
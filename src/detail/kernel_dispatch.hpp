@@ -0,0 +1,85 @@
+/**
+ * @file geometry/detail/kernel_dispatch.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Internal multiversioning of batch kernels
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__DETAIL__KERNEL_DISPATCH_HPP_
+#define GEOMETRY__DETAIL__KERNEL_DISPATCH_HPP_
+
+#include "geometry/cpu_dispatch.hpp"
+
+// Variants are compiled with per-function target attributes rather than per
+// file flags. Inline functions the kernels call are then still emitted with
+// the baseline flags wherever they are not inlined, so the linker can never
+// pick an AVX copy of a shared inline function for baseline callers.
+#if defined(GEOMETRY_BUILD_ALL_KERNELS) && defined(__x86_64__) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define GEOMETRY_X86_KERNELS 1
+#define GEOMETRY_TARGET_AVX2 __attribute__((target("avx2,fma,bmi,bmi2")))
+#define GEOMETRY_TARGET_AVX512 \
+  __attribute__((target(     \
+      "avx512f,avx512vl,avx512dq,avx512bw,avx2,fma,bmi,bmi2")))
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define GEOMETRY_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define GEOMETRY_ALWAYS_INLINE inline
+#endif
+
+namespace geometry {
+namespace detail {
+
+/**
+ * @brief Variants of the kernel body Body, one per kernel path. Body should
+ * be GEOMETRY_ALWAYS_INLINE, so that each variant compiles its own copy with
+ * its target flags.
+ */
+template <auto Body>
+struct Kernel;
+
+template <typename... Args, void (*Body)(Args...)>
+struct Kernel<Body> {
+  static auto Baseline(Args... args) -> void { Body(args...); }
+
+#if defined(GEOMETRY_X86_KERNELS)
+  GEOMETRY_TARGET_AVX2 static auto Avx2(Args... args) -> void {
+    Body(args...);
+  }
+
+  GEOMETRY_TARGET_AVX512 static auto Avx512(Args... args) -> void {
+    Body(args...);
+  }
+#endif
+};
+
+/**
+ * @brief The variant of a kernel body for the bound kernel path.
+ * @return The kernel function.
+ */
+template <auto Body>
+auto DispatchKernel() -> decltype(Body) {
+#if defined(GEOMETRY_X86_KERNELS)
+  switch (GetKernelPath()) {
+    case KernelPath::kAvx512:
+      return &Kernel<Body>::Avx512;
+    case KernelPath::kAvx2:
+      return &Kernel<Body>::Avx2;
+    default:
+      break;
+  }
+#endif
+  return &Kernel<Body>::Baseline;
+}
+
+}  // namespace detail
+}  // namespace geometry
+
+#endif  // GEOMETRY__DETAIL__KERNEL_DISPATCH_HPP_
@@ -0,0 +1,116 @@
+/**
+ * @file geometry/detail/parallel.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Internal fork-join helpers for batch kernels
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__DETAIL__PARALLEL_HPP_
+#define GEOMETRY__DETAIL__PARALLEL_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace geometry {
+namespace detail {
+
+// Requests beyond this many threads per hardware thread only cost memory and
+// thread creation, so they are capped.
+constexpr std::size_t kMaxThreadsPerHardwareThread{8};
+
+/**
+ * @brief Resolve a requested thread count, where 0 means all hardware threads.
+ * @param requested The requested thread count.
+ * @return std::size_t The thread count, at least 1 and at most
+ * kMaxThreadsPerHardwareThread per hardware thread.
+ */
+inline auto ResolveThreadCount(std::size_t requested) -> std::size_t {
+  const std::size_t hardware{
+      std::max<std::size_t>(1, std::thread::hardware_concurrency())};
+  if (requested == 0) {
+    return hardware;
+  }
+  return std::min(requested, kMaxThreadsPerHardwareThread * hardware);
+}
+
+/**
+ * @brief Run function(begin, end, worker) over [0, count) in chunks of grain
+ * elements, handing chunks out dynamically to at most thread_count workers.
+ * The calling thread is worker 0. The first exception thrown by any worker,
+ * or by starting one, is rethrown after all started workers joined.
+ * @param count The number of elements.
+ * @param grain The number of elements per chunk.
+ * @param thread_count The number of workers, 0 for all hardware threads.
+ * @param function The chunk function.
+ */
+template <typename Function>
+auto ParallelFor(std::size_t count, std::size_t grain, std::size_t thread_count,
+                 Function&& function) -> void {
+  grain = std::max<std::size_t>(1, grain);
+  const std::size_t chunk_count{(count + grain - 1) / grain};
+  const std::size_t worker_count{
+      std::min(ResolveThreadCount(thread_count), chunk_count)};
+  if (worker_count <= 1) {
+    if (count != 0) {
+      function(std::size_t{0}, count, std::size_t{0});
+    }
+    return;
+  }
+
+  std::atomic<std::size_t> next_chunk{0};
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  auto work{[&](std::size_t worker) {
+    try {
+      for (auto chunk{next_chunk.fetch_add(1)}; chunk < chunk_count;
+           chunk = next_chunk.fetch_add(1)) {
+        const std::size_t begin{chunk * grain};
+        function(begin, std::min(count, begin + grain), worker);
+      }
+    } catch (...) {
+      const std::lock_guard<std::mutex> lock(error_mutex);
+      if (!error) {
+        error = std::current_exception();
+      }
+      next_chunk.store(chunk_count);
+    }
+  }};
+
+  std::vector<std::thread> workers;
+  try {
+    workers.reserve(worker_count - 1);
+    for (std::size_t worker = 1; worker < worker_count; ++worker) {
+      workers.emplace_back(work, worker);
+    }
+  } catch (...) {
+    // Out of threads: stop handing out chunks, but join the started workers
+    // before the error leaves, as destroying a joinable thread terminates.
+    const std::lock_guard<std::mutex> lock(error_mutex);
+    if (!error) {
+      error = std::current_exception();
+    }
+    next_chunk.store(chunk_count);
+  }
+  work(0);
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+}  // namespace detail
+}  // namespace geometry
+
+#endif  // GEOMETRY__DETAIL__PARALLEL_HPP_
@@ -0,0 +1,146 @@
+/**
+ * @file geometry/detail/radix_sort.hpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Internal parallel LSD radix sort of unsigned integer keys
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#ifndef GEOMETRY__DETAIL__RADIX_SORT_HPP_
+#define GEOMETRY__DETAIL__RADIX_SORT_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "detail/parallel.hpp"
+
+namespace geometry {
+namespace detail {
+
+constexpr std::size_t kRadixBits{8};
+constexpr std::size_t kRadixSize{std::size_t{1} << kRadixBits};
+// Elements per chunk; every chunk keeps its own histogram so that chunks can
+// be counted and scattered by different workers.
+constexpr std::size_t kRadixGrain{std::size_t{1} << 16};
+
+/**
+ * @brief Digit of a key at a bit shift.
+ */
+template <typename Key>
+inline auto Digit(Key key, std::size_t shift) -> std::size_t {
+  return static_cast<std::size_t>(key >> shift) & (kRadixSize - 1);
+}
+
+/**
+ * @brief Run function(first, last) over the kRadixGrain chunks of a range
+ * that starts on a chunk boundary, since ParallelFor may hand out several
+ * chunks in one call.
+ */
+template <typename Function>
+auto ForEachChunk(std::size_t begin, std::size_t end, Function&& function)
+    -> void {
+  for (std::size_t first = begin; first < end; first += kRadixGrain) {
+    function(first, std::min(end, first + kRadixGrain));
+  }
+}
+
+/**
+ * @brief Stable LSD radix sort of count unsigned keys, moving values along if
+ * it is not null. Digits on which all keys agree are skipped.
+ * @param keys The keys.
+ * @param values The values, or nullptr.
+ * @param count The number of keys.
+ * @param thread_count The number of workers, 0 for all hardware threads.
+ */
+template <typename Key, typename Value>
+auto RadixSort(Key* keys, Value* values, std::size_t count,
+               std::size_t thread_count) -> void {
+  static_assert(std::is_unsigned<Key>::value, "Keys must be unsigned");
+  if (count < 2) {
+    return;
+  }
+  const std::size_t chunk_count{(count + kRadixGrain - 1) / kRadixGrain};
+  std::vector<std::array<std::size_t, kRadixSize>> offsets(chunk_count);
+  std::vector<Key> key_buffer(count);
+  std::vector<Value> value_buffer(values == nullptr ? 0 : count);
+  Key* source_keys{keys};
+  Key* target_keys{key_buffer.data()};
+  Value* source_values{values};
+  Value* target_values{value_buffer.data()};
+
+  for (std::size_t shift = 0; shift < 8 * sizeof(Key); shift += kRadixBits) {
+    ParallelFor(count, kRadixGrain, thread_count,
+                [&](std::size_t begin, std::size_t end, std::size_t) {
+                  ForEachChunk(begin, end, [&](std::size_t first,
+                                               std::size_t last) {
+                    auto& histogram{offsets[first / kRadixGrain]};
+                    histogram.fill(0);
+                    for (std::size_t i = first; i < last; ++i) {
+                      ++histogram[Digit(source_keys[i], shift)];
+                    }
+                  });
+                });
+    // Digit-major prefix over the chunks keeps equal digits in input order.
+    std::size_t total{0};
+    bool uniform{false};
+    for (std::size_t digit = 0; digit < kRadixSize; ++digit) {
+      const std::size_t first{total};
+      for (auto& histogram : offsets) {
+        const std::size_t size{histogram[digit]};
+        histogram[digit] = total;
+        total += size;
+      }
+      uniform = uniform || (total - first == count);
+    }
+    if (uniform) {
+      continue;
+    }
+    ParallelFor(count, kRadixGrain, thread_count,
+                [&](std::size_t begin, std::size_t end, std::size_t) {
+                  ForEachChunk(begin, end, [&](std::size_t first,
+                                               std::size_t last) {
+                    auto& offset{offsets[first / kRadixGrain]};
+                    for (std::size_t i = first; i < last; ++i) {
+                      const std::size_t target{
+                          offset[Digit(source_keys[i], shift)]++};
+                      target_keys[target] = source_keys[i];
+                      if (values != nullptr) {
+                        target_values[target] = source_values[i];
+                      }
+                    }
+                  });
+                });
+    std::swap(source_keys, target_keys);
+    std::swap(source_values, target_values);
+  }
+  if (source_keys != keys) {
+    std::copy(source_keys, source_keys + count, keys);
+    if (values != nullptr) {
+      std::copy(source_values, source_values + count, values);
+    }
+  }
+}
+
+/**
+ * @brief Stable LSD radix sort of unsigned keys.
+ * @param keys The keys.
+ * @param thread_count The number of workers, 0 for all hardware threads.
+ */
+template <typename Key>
+auto RadixSort(std::vector<Key>& keys, std::size_t thread_count) -> void {
+  RadixSort(keys.data(), static_cast<uint32_t*>(nullptr), keys.size(),
+            thread_count);
+}
+
+}  // namespace detail
+}  // namespace geometry
+
+#endif  // GEOMETRY__DETAIL__RADIX_SORT_HPP_
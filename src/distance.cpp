@@ -13,8 +13,15 @@
 #include "geometry/distance.hpp"
 
 #include <cstdint>
+#include <stdexcept>
 #include <tuple>
 
+#include "geometry/instrumentation.hpp"
+
+#if !defined(GEOMETRY_INLINE_HOT_PATH)
+#include "geometry/distance_inline.hpp"
+#endif
+
 namespace {
 constexpr int64_t kKilometerToNanometer{static_cast<int64_t>(1.0e+12)};
 constexpr int64_t kMeterToNanometer{static_cast<int64_t>(1.0e+9)};
@@ -31,6 +38,9 @@ constexpr double kNanometerToMicrometer{1.0e-3};
 auto ScaleDistanceToNanometer(double input_value,
                               geometry::Distance::Type input_type) -> int64_t {
   int64_t result{static_cast<int64_t>(input_value)};
+  if (input_type != geometry::Distance::Type::kNanometer) {
+    GEOMETRY_INSTRUMENT_COUNT(kDistanceToNanometer);
+  }
   if (input_type == geometry::Distance::Type::kKilometer) {
     result = static_cast<int64_t>(input_value * kKilometerToNanometer);
   } else if (input_type == geometry::Distance::Type::kMeter) {
@@ -52,6 +62,7 @@ Distance::Distance(double input_value, Type input_type)
     : nanometer_(ScaleDistanceToNanometer(input_value, input_type)) {}
 
 auto Distance::GetValue(const Type &input_type) const -> double {
+  GEOMETRY_INSTRUMENT_COUNT(kDistanceFromNanometer);
   auto result{static_cast<double>(nanometer_)};
   if (input_type == geometry::Distance::Type::kKilometer) {
     result = result * kNanometerToKilometer;
@@ -71,30 +82,6 @@ auto Distance::SetValue(double input_value, const Type &input_type) -> void {
   nanometer_ = ScaleDistanceToNanometer(input_value, input_type);
 }
 
-auto Distance::operator==(const Distance &other) const -> bool {
-  return (nanometer_ == other.nanometer_);
-}
-
-auto Distance::operator!=(const Distance &other) const -> bool {
-  return (nanometer_ != other.nanometer_);
-}
-
-auto Distance::operator<(const Distance &other) const -> bool {
-  return (nanometer_ < other.nanometer_);
-}
-
-auto Distance::operator<=(const Distance &other) const -> bool {
-  return (nanometer_ <= other.nanometer_);
-}
-
-auto Distance::operator>(const Distance &other) const -> bool {
-  return (nanometer_ > other.nanometer_);
-}
-
-auto Distance::operator>=(const Distance &other) const -> bool {
-  return (nanometer_ >= other.nanometer_);
-}
-
 auto Distance::operator+(const Distance &other) const -> Distance {
   return Distance(static_cast<double>(nanometer_ + other.nanometer_),
                   Type::kNanometer);
@@ -112,6 +99,7 @@ auto Distance::operator*(double scale) const -> Distance {
 
 auto Distance::operator/(double scale) const -> Distance {
   if (scale == 0.0) {
+    GEOMETRY_INSTRUMENT_COUNT(kDistanceDivisionByZero);
     throw std::invalid_argument("Invalid input: Division by zero");
   }
 
@@ -133,6 +121,7 @@ auto Distance::operator*=(double scale) -> void {
 
 auto Distance::operator/=(double scale) -> void {
   if (scale == 0.0) {
+    GEOMETRY_INSTRUMENT_COUNT(kDistanceDivisionByZero);
     throw std::invalid_argument("Invalid input: Division by zero");
   }
   double result = static_cast<double>(nanometer_) / scale;
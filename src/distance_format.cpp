@@ -0,0 +1,259 @@
+/**
+ * @file geometry/distance_format.cpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Allocation-free parsing and formatting of Distance strings
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/distance_format.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <system_error>
+
+namespace {
+struct Unit {
+  std::string_view suffix;  ///< Unit suffix
+  std::size_t exponent;     ///< Nanometers per unit as a power of ten
+};
+
+// Suffixes tried in order when parsing, so "m" comes after the longer ones.
+constexpr std::array<Unit, 7> kParseUnits{{{"km", 12},
+                                           {"cm", 7},
+                                           {"mm", 6},
+                                           {"um", 3},
+                                           {"\xC2\xB5m", 3},
+                                           {"nm", 0},
+                                           {"m", 9}}};
+
+// Suffixes indexed by Distance::Type.
+constexpr std::array<Unit, 6> kFormatUnits{
+    {{"km", 12}, {"m", 9}, {"cm", 7}, {"mm", 6}, {"um", 3}, {"nm", 0}}};
+
+constexpr std::size_t kMeterExponent{9};
+
+constexpr std::array<uint64_t, 13> kPowers{1ULL,
+                                           10ULL,
+                                           100ULL,
+                                           1000ULL,
+                                           10000ULL,
+                                           100000ULL,
+                                           1000000ULL,
+                                           10000000ULL,
+                                           100000000ULL,
+                                           1000000000ULL,
+                                           10000000000ULL,
+                                           100000000000ULL,
+                                           1000000000000ULL};
+
+constexpr auto kMaxNanometer{
+    static_cast<uint64_t>(std::numeric_limits<int64_t>::max())};
+// 2^63 as a double, the first magnitude that does not fit unless negative.
+constexpr double kNanometerLimit{9.223372036854775808e18};
+
+inline auto IsDigit(char character) -> bool {
+  return character >= '0' && character <= '9';
+}
+
+inline auto IsLetter(char character) -> bool {
+  return (character >= 'a' && character <= 'z') ||
+         (character >= 'A' && character <= 'Z');
+}
+
+auto SkipDigits(const char* first, const char* last) -> const char* {
+  while (first != last && IsDigit(*first)) {
+    ++first;
+  }
+  return first;
+}
+
+/**
+ * @brief Match a unit suffix at first, not followed by another letter.
+ */
+auto MatchUnit(const char* first, const char* last) -> const Unit* {
+  const auto size{static_cast<std::size_t>(last - first)};
+  for (const auto& unit : kParseUnits) {
+    const std::size_t length{unit.suffix.size()};
+    if (size >= length &&
+        std::memcmp(first, unit.suffix.data(), length) == 0 &&
+        (size == length || !IsLetter(first[length]))) {
+      return &unit;
+    }
+  }
+  return nullptr;
+}
+
+/**
+ * @brief Convert whole.fraction units of 10^exponent nanometers exactly,
+ * rounding half away from zero. Returns false on overflow; a negative
+ * magnitude may reach 2^63.
+ */
+auto ToNanometer(uint64_t whole, const char* fraction,
+                 std::size_t fraction_digits, std::size_t exponent,
+                 bool negative, uint64_t& nanometer) -> bool {
+  const uint64_t max_nanometer{negative ? kMaxNanometer + 1 : kMaxNanometer};
+  const uint64_t scale{kPowers[exponent]};
+  if (whole > max_nanometer / scale) {
+    return false;
+  }
+  nanometer = whole * scale;
+  const std::size_t digits{std::min(fraction_digits, exponent)};
+  if (digits != 0) {
+    uint64_t value{0};
+    std::from_chars(fraction, fraction + digits, value);
+    value *= kPowers[exponent - digits];
+    if (value > max_nanometer - nanometer) {
+      return false;
+    }
+    nanometer += value;
+  }
+  if (fraction_digits > exponent && fraction[exponent] >= '5') {
+    if (nanometer == max_nanometer) {
+      return false;
+    }
+    ++nanometer;
+  }
+  return true;
+}
+}  // namespace
+
+namespace geometry {
+
+auto ParseDistance(const char* first, const char* last, Distance& distance)
+    -> std::from_chars_result {
+  const char* cursor{first};
+  const bool negative{cursor != last && *cursor == '-'};
+  if (cursor != last && (*cursor == '-' || *cursor == '+')) {
+    ++cursor;
+  }
+  const char* number{cursor};
+  uint64_t whole{0};
+  if (cursor != last && IsDigit(*cursor)) {
+    const auto result{std::from_chars(cursor, last, whole)};
+    if (result.ec != std::errc{}) {
+      return {first, result.ec};
+    }
+    cursor = result.ptr;
+  }
+  const bool has_whole{cursor != number};
+  const char* fraction{cursor};
+  if (cursor != last && *cursor == '.') {
+    fraction = cursor + 1;
+    cursor = SkipDigits(fraction, last);
+  }
+  const auto fraction_digits{static_cast<std::size_t>(cursor - fraction)};
+  if (!has_whole && fraction_digits == 0) {
+    return {first, std::errc::invalid_argument};
+  }
+  bool has_exponent{false};
+  if (cursor != last && (*cursor == 'e' || *cursor == 'E')) {
+    const char* exponent{cursor + 1};
+    if (exponent != last && (*exponent == '-' || *exponent == '+')) {
+      ++exponent;
+    }
+    if (exponent != last && IsDigit(*exponent)) {
+      has_exponent = true;
+      cursor = SkipDigits(exponent, last);
+    }
+  }
+  const char* number_end{cursor};
+
+  const char* suffix{number_end};
+  while (suffix != last && *suffix == ' ') {
+    ++suffix;
+  }
+  std::size_t unit_exponent{kMeterExponent};
+  const char* end{number_end};
+  if (const Unit* unit{MatchUnit(suffix, last)}; unit != nullptr) {
+    unit_exponent = unit->exponent;
+    end = suffix + unit->suffix.size();
+  } else if (suffix != last && IsLetter(*suffix)) {
+    return {first, std::errc::invalid_argument};
+  }
+
+  uint64_t nanometer{0};
+  if (has_exponent) {
+    double value{0.0};
+    const auto result{std::from_chars(number, number_end, value)};
+    const double scaled{value * static_cast<double>(kPowers[unit_exponent])};
+    if (result.ec != std::errc{} ||
+        !(negative ? scaled <= kNanometerLimit : scaled < kNanometerLimit)) {
+      return {first, std::errc::result_out_of_range};
+    }
+    nanometer = static_cast<uint64_t>(std::round(scaled));
+  } else if (!ToNanometer(whole, fraction, fraction_digits, unit_exponent,
+                          negative, nanometer)) {
+    return {first, std::errc::result_out_of_range};
+  }
+  // Negate in unsigned arithmetic so that 2^63 becomes the most negative.
+  distance = Distance::FromNanometer(
+      static_cast<int64_t>(negative ? 0 - nanometer : nanometer));
+  return {end, std::errc{}};
+}
+
+auto FormatDistance(char* first, char* last, const Distance& distance,
+                    Distance::Type unit) -> std::to_chars_result {
+  const Unit& format{kFormatUnits.at(static_cast<std::size_t>(unit))};
+  const int64_t nanometer{distance.GetNanometer()};
+  // Negate in unsigned arithmetic so the most negative value works too.
+  const uint64_t magnitude{nanometer < 0 ? 0 - static_cast<uint64_t>(nanometer)
+                                         : static_cast<uint64_t>(nanometer)};
+  char* cursor{first};
+  if (nanometer < 0) {
+    if (cursor == last) {
+      return {last, std::errc::value_too_large};
+    }
+    *cursor++ = '-';
+  }
+  const uint64_t scale{kPowers[format.exponent]};
+  const auto result{std::to_chars(cursor, last, magnitude / scale)};
+  if (result.ec != std::errc{}) {
+    return result;
+  }
+  cursor = result.ptr;
+  uint64_t fraction{magnitude % scale};
+  if (fraction != 0) {
+    std::size_t digits{format.exponent};
+    while (fraction % 10 == 0) {
+      fraction /= 10;
+      --digits;
+    }
+    if (static_cast<std::size_t>(last - cursor) < digits + 1) {
+      return {last, std::errc::value_too_large};
+    }
+    *cursor++ = '.';
+    for (std::size_t i = digits; i > 0; --i) {
+      cursor[i - 1] = static_cast<char>('0' + (fraction % 10));
+      fraction /= 10;
+    }
+    cursor += digits;
+  }
+  if (static_cast<std::size_t>(last - cursor) < format.suffix.size()) {
+    return {last, std::errc::value_too_large};
+  }
+  std::memcpy(cursor, format.suffix.data(), format.suffix.size());
+  return {cursor + format.suffix.size(), std::errc{}};
+}
+
+auto ParseDistances(const std::string_view* texts, std::size_t count,
+                    Distance* distances) -> std::size_t {
+  for (std::size_t i = 0; i < count; ++i) {
+    const char* last{texts[i].data() + texts[i].size()};
+    const auto result{ParseDistance(texts[i].data(), last, distances[i])};
+    if (result.ec != std::errc{} || result.ptr != last) {
+      return i;
+    }
+  }
+  return count;
+}
+
+}  // namespace geometry
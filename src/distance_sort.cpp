@@ -0,0 +1,274 @@
+/**
+ * @file geometry/distance_sort.cpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Radix sorting, top-k selection and histograms of Distance arrays
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/distance_sort.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+#include "detail/parallel.hpp"
+#include "detail/radix_sort.hpp"
+
+namespace {
+constexpr uint64_t kSignBit{uint64_t{1} << 63U};
+constexpr std::size_t kKeyGrain{std::size_t{1} << 14};
+constexpr std::size_t kHistogramGrain{std::size_t{1} << 16};
+constexpr std::size_t kBlockSize{256};
+// Consecutive distances count into different copies of the histogram, so
+// that runs of one bin do not wait on the previous increment.
+constexpr std::size_t kLaneCount{4};
+
+/**
+ * @brief Unsigned key of a distance that sorts like its signed nanometers.
+ */
+inline auto ToKey(const geometry::Distance& distance) -> uint64_t {
+  return static_cast<uint64_t>(distance.GetNanometer()) ^ kSignBit;
+}
+
+/**
+ * @brief Distance of an unsigned key.
+ */
+inline auto FromKey(uint64_t key) -> geometry::Distance {
+  return geometry::Distance::FromNanometer(
+      static_cast<int64_t>(key ^ kSignBit));
+}
+
+auto ComputeKeys(const geometry::Distance* distances, std::size_t count,
+                 std::size_t thread_count) -> std::vector<uint64_t> {
+  std::vector<uint64_t> keys(count);
+  geometry::detail::ParallelFor(
+      count, kKeyGrain, thread_count,
+      [&](std::size_t begin, std::size_t end, std::size_t) {
+        for (std::size_t i = begin; i < end; ++i) {
+          keys[i] = ToKey(distances[i]);
+        }
+      });
+  return keys;
+}
+
+auto CheckIndexRange(std::size_t count) -> void {
+  if (count > std::numeric_limits<uint32_t>::max()) {
+    throw std::invalid_argument("Invalid input: Too many distances");
+  }
+}
+
+/**
+ * @brief Map of nanometers to histogram slots, 0 for the underflow, i + 1 for
+ * bin i and bin_count + 1 for the overflow. A floating point quotient is off
+ * by at most one bin and corrected with integer products, which avoids a
+ * 64 bit division per distance.
+ */
+class BinMap {
+ public:
+  BinMap(int64_t origin, int64_t width, std::size_t bin_count)
+      : origin_(origin),
+        width_(static_cast<uint64_t>(width)),
+        bin_count_(bin_count),
+        inverse_(1.0 / static_cast<double>(width)),
+        last_(static_cast<double>(bin_count)) {}
+
+  [[nodiscard]] auto Slot(int64_t nanometer) const -> std::size_t {
+    const uint64_t offset{static_cast<uint64_t>(nanometer) -
+                          static_cast<uint64_t>(origin_)};
+    auto bin{static_cast<uint64_t>(
+        std::min(static_cast<double>(offset) * inverse_, last_))};
+    bin -= (bin * width_ > offset) ? 1U : 0U;
+    bin += (bin < bin_count_ && (bin + 1) * width_ <= offset) ? 1U : 0U;
+    return nanometer < origin_ ? 0 : static_cast<std::size_t>(bin) + 1;
+  }
+
+ private:
+  int64_t origin_;      ///< Lower bound of the first bin
+  uint64_t width_;      ///< Bin width
+  uint64_t bin_count_;  ///< Number of bins
+  double inverse_;      ///< Bins per nanometer
+  double last_;         ///< Largest estimate, the overflow bin
+};
+}  // namespace
+
+namespace geometry {
+
+auto SortDistances(Distance* distances, uint32_t* indices, std::size_t count,
+                   std::size_t thread_count) -> void {
+  std::vector<uint64_t> keys{ComputeKeys(distances, count, thread_count)};
+  detail::RadixSort(keys.data(), indices, count, thread_count);
+  detail::ParallelFor(count, kKeyGrain, thread_count,
+                      [&](std::size_t begin, std::size_t end, std::size_t) {
+                        for (std::size_t i = begin; i < end; ++i) {
+                          distances[i] = FromKey(keys[i]);
+                        }
+                      });
+}
+
+auto SortDistances(std::vector<Distance>& distances, std::size_t thread_count)
+    -> void {
+  SortDistances(distances.data(), nullptr, distances.size(), thread_count);
+}
+
+auto ArgsortDistances(const std::vector<Distance>& distances,
+                      std::size_t thread_count) -> std::vector<uint32_t> {
+  CheckIndexRange(distances.size());
+  std::vector<uint32_t> order(distances.size());
+  std::iota(order.begin(), order.end(), 0U);
+  std::vector<uint64_t> keys{
+      ComputeKeys(distances.data(), distances.size(), thread_count)};
+  detail::RadixSort(keys.data(), order.data(), keys.size(), thread_count);
+  return order;
+}
+
+auto SelectSmallestDistances(const std::vector<Distance>& distances,
+                             std::size_t k) -> std::vector<uint32_t> {
+  CheckIndexRange(distances.size());
+  k = std::min(k, distances.size());
+  std::vector<uint32_t> selected;
+  selected.reserve(k);
+  if (k == 0) {
+    return selected;
+  }
+  const std::vector<uint64_t> keys{
+      ComputeKeys(distances.data(), distances.size(), 1)};
+
+  // From the highest byte on which keys differ down: keys below the byte of
+  // the k-th smallest are selected, keys with that byte remain candidates.
+  const auto range{std::minmax_element(keys.begin(), keys.end())};
+  const uint64_t differing{*range.first ^ *range.second};
+  std::size_t level{sizeof(uint64_t)};
+  while (level > 1 &&
+         detail::Digit(differing, (level - 1) * detail::kRadixBits) == 0) {
+    --level;
+  }
+  std::vector<uint32_t> candidates;
+  std::vector<uint32_t> next;
+  bool first_pass{true};
+  std::size_t remaining{k};
+  auto for_each_candidate{[&](auto&& function) {
+    if (first_pass) {
+      for (uint32_t index = 0; index < keys.size(); ++index) {
+        function(index);
+      }
+    } else {
+      for (const uint32_t index : candidates) {
+        function(index);
+      }
+    }
+  }};
+  while (level-- > 0) {
+    const std::size_t shift{level * detail::kRadixBits};
+    std::array<std::size_t, detail::kRadixSize> histogram{};
+    for_each_candidate([&](uint32_t index) {
+      ++histogram[detail::Digit(keys[index], shift)];
+    });
+    std::size_t pivot{0};
+    std::size_t below{0};
+    while (below + histogram[pivot] < remaining) {
+      below += histogram[pivot];
+      ++pivot;
+    }
+    next.clear();
+    next.reserve(histogram[pivot]);
+    for_each_candidate([&](uint32_t index) {
+      const std::size_t digit{detail::Digit(keys[index], shift)};
+      if (digit < pivot) {
+        selected.push_back(index);
+      } else if (digit == pivot) {
+        next.push_back(index);
+      }
+    });
+    candidates.swap(next);
+    first_pass = false;
+    remaining -= below;
+    if (candidates.size() == remaining) {
+      break;
+    }
+  }
+  // Candidates left after the last byte share one key, in input order.
+  selected.insert(selected.end(), candidates.begin(),
+                  candidates.begin() + static_cast<std::ptrdiff_t>(remaining));
+
+  std::vector<uint64_t> selected_keys(selected.size());
+  for (std::size_t i = 0; i < selected.size(); ++i) {
+    selected_keys[i] = keys[selected[i]];
+  }
+  detail::RadixSort(selected_keys.data(), selected.data(), selected.size(), 1);
+  return selected;
+}
+
+auto HistogramDistances(const Distance* distances, std::size_t count,
+                        const Distance& origin, const Distance& bin_width,
+                        std::size_t bin_count, std::size_t thread_count)
+    -> DistanceHistogram {
+  const int64_t width{bin_width.GetNanometer()};
+  if (width <= 0) {
+    throw std::invalid_argument("Invalid input: Bin width must be positive");
+  }
+  if (bin_count == 0) {
+    throw std::invalid_argument("Invalid input: Bin count must be positive");
+  }
+  if (bin_count > static_cast<uint64_t>(std::numeric_limits<int64_t>::max() /
+                                        width)) {
+    throw std::invalid_argument("Invalid input: Histogram range overflow");
+  }
+  const BinMap map(origin.GetNanometer(), width, bin_count);
+  const std::size_t slot_count{bin_count + 2};
+
+  std::vector<std::vector<uint64_t>> lanes(
+      detail::ResolveThreadCount(thread_count));
+  detail::ParallelFor(
+      count, kHistogramGrain, thread_count,
+      [&](std::size_t begin, std::size_t end, std::size_t worker) {
+        auto& lane{lanes[worker]};
+        if (lane.empty()) {
+          lane.assign(kLaneCount * slot_count, 0);
+        }
+        std::array<int64_t, kBlockSize> nanometers{};
+        std::array<std::size_t, kBlockSize> slots{};
+        for (std::size_t first = begin; first < end; first += kBlockSize) {
+          const std::size_t size{std::min(kBlockSize, end - first)};
+          for (std::size_t i = 0; i < size; ++i) {
+            nanometers[i] = distances[first + i].GetNanometer();
+          }
+          for (std::size_t i = 0; i < size; ++i) {
+            slots[i] = map.Slot(nanometers[i]);
+          }
+          for (std::size_t i = 0; i < size; ++i) {
+            ++lane[((i % kLaneCount) * slot_count) + slots[i]];
+          }
+        }
+      });
+
+  std::vector<uint64_t> totals(slot_count, 0);
+  for (const auto& lane : lanes) {
+    for (std::size_t i = 0; i < lane.size(); ++i) {
+      totals[i % slot_count] += lane[i];
+    }
+  }
+  DistanceHistogram histogram;
+  histogram.origin = origin;
+  histogram.bin_width = bin_width;
+  histogram.underflow = totals.front();
+  histogram.overflow = totals.back();
+  histogram.counts.assign(totals.begin() + 1, totals.end() - 1);
+  return histogram;
+}
+
+auto HistogramDistances(const std::vector<Distance>& distances,
+                        const Distance& origin, const Distance& bin_width,
+                        std::size_t bin_count, std::size_t thread_count)
+    -> DistanceHistogram {
+  return HistogramDistances(distances.data(), distances.size(), origin,
+                            bin_width, bin_count, thread_count);
+}
+
+}  // namespace geometry
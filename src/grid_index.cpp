@@ -0,0 +1,131 @@
+/**
+ * @file geometry/grid_index.cpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Uniform grid spatial partition over Point2D sets
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/grid_index.hpp"
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+constexpr double kAutoPointsPerCell{2.0};
+constexpr std::size_t kCellsPerPoint{4U};
+constexpr std::size_t kMinCellBudget{16U};
+}  // namespace
+
+namespace geometry {
+
+GridIndex::GridIndex(const std::vector<Point2D>& points,
+                     const Distance& cell_size) {
+  Build(points, cell_size);
+}
+
+auto GridIndex::Build(const std::vector<Point2D>& points,
+                      const Distance& cell_size) -> void {
+  const std::size_t count{points.size()};
+  if (count >= std::numeric_limits<uint32_t>::max()) {
+    throw std::invalid_argument("Invalid input: Too many points");
+  }
+  double requested{cell_size.GetValue(Distance::Type::kMeter)};
+  if (requested < 0.0) {
+    throw std::invalid_argument("Invalid input: Negative cell size");
+  }
+
+  double min_x{0.0};
+  double min_y{0.0};
+  double max_x{0.0};
+  double max_y{0.0};
+  if (count != 0) {
+    min_x = max_x = points.front().GetX();
+    min_y = max_y = points.front().GetY();
+  }
+  for (const auto& point : points) {
+    const double x{point.GetX()};
+    const double y{point.GetY()};
+    if (!std::isfinite(x) || !std::isfinite(y)) {
+      throw std::invalid_argument("Invalid input: Non-finite coordinate");
+    }
+    min_x = std::min(min_x, x);
+    max_x = std::max(max_x, x);
+    min_y = std::min(min_y, y);
+    max_y = std::max(max_y, y);
+  }
+
+  const double width{max_x - min_x};
+  const double height{max_y - min_y};
+  if (!std::isfinite(width) || !std::isfinite(height)) {
+    throw std::invalid_argument("Invalid input: Bounds too wide");
+  }
+  if (requested == 0.0 && count != 0) {
+    const double area{width * height};
+    if (area > 0.0) {
+      requested = std::sqrt(area * kAutoPointsPerCell /
+                            static_cast<double>(count));
+    } else {
+      requested = std::max(width, height) * kAutoPointsPerCell /
+                  static_cast<double>(count);
+    }
+    // The area may overflow; one cell over the bounds is always finite, and
+    // the doubling below stops before it could overflow in turn.
+    if (!std::isfinite(requested)) {
+      requested = std::max(width, height);
+    }
+  }
+  if (!(requested > 0.0)) {
+    requested = 1.0;
+  }
+
+  // Outliers may stretch the bounds far beyond the bulk of the data, so the
+  // number of cells is kept proportional to the number of points.
+  const std::size_t budget{
+      std::min<std::size_t>(kMinCellBudget + (kCellsPerPoint * count),
+                            std::numeric_limits<uint32_t>::max() - 1)};
+  auto cells_along{[](double extent, double size) {
+    return std::floor(extent / size) + 1.0;
+  }};
+  while (cells_along(width, requested) * cells_along(height, requested) >
+         static_cast<double>(budget)) {
+    requested *= 2.0;
+  }
+
+  min_x_ = min_x;
+  min_y_ = min_y;
+  cell_size_ = requested;
+  inverse_cell_size_ = 1.0 / requested;
+  columns_ = static_cast<std::size_t>(cells_along(width, requested));
+  rows_ = static_cast<std::size_t>(cells_along(height, requested));
+
+  std::vector<uint32_t> cell_of(count);
+  cell_begin_.assign((columns_ * rows_) + 1, 0);
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto cell{static_cast<uint32_t>(
+        (GetRow(points[i].GetY()) * columns_) + GetColumn(points[i].GetX()))};
+    cell_of[i] = cell;
+    ++cell_begin_[cell + 1];
+  }
+  for (std::size_t cell = 1; cell < cell_begin_.size(); ++cell) {
+    cell_begin_[cell] += cell_begin_[cell - 1];
+  }
+
+  xs_.resize(count);
+  ys_.resize(count);
+  indices_.resize(count);
+  std::vector<uint32_t> cursor(cell_begin_.begin(), cell_begin_.end() - 1);
+  for (std::size_t i = 0; i < count; ++i) {
+    const uint32_t slot{cursor[cell_of[i]]++};
+    xs_[slot] = points[i].GetX();
+    ys_[slot] = points[i].GetY();
+    indices_[slot] = static_cast<uint32_t>(i);
+  }
+}
+
+}  // namespace geometry
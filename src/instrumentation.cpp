@@ -0,0 +1,343 @@
+/**
+ * @file geometry/instrumentation.cpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Compile-time toggleable counters and latency histograms
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/instrumentation.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#if defined(GEOMETRY_ENABLE_INSTRUMENTATION) && defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+constexpr std::array<const char*, geometry::instrumentation::kProbeCount>
+    kProbeNames{
+        "point2d.calculate_distance",  "point2d.division_by_zero",
+        "distance.to_nanometer",       "distance.from_nanometer",
+        "distance.division_by_zero",   "knn_join",
+        "dbscan",                      "kmeans",
+        "polyline_distance",           "delaunay",
+        "concurrent_grid_index.update",
+    };
+
+constexpr double kMedian{0.5};
+constexpr double kPercentile99{0.99};
+constexpr double kPercentile999{0.999};
+
+#ifdef GEOMETRY_ENABLE_INSTRUMENTATION
+using Cell = std::atomic<uint64_t>;
+
+/**
+ * @brief Counters owned by one thread. Only the owner writes, so increments
+ * are a relaxed load and store instead of a locked read-modify-write.
+ */
+struct ThreadBlock {
+  std::array<Cell, geometry::instrumentation::kProbeCount> counts{};
+  std::array<Cell, geometry::instrumentation::kProbeCount> samples{};
+  std::array<Cell, geometry::instrumentation::kProbeCount> total_ns{};
+  std::array<std::array<Cell, geometry::instrumentation::kHistogramBucketCount>,
+             geometry::instrumentation::kProbeCount>
+      buckets{};
+};
+
+auto Bump(Cell& cell, uint64_t delta) -> void {
+  cell.store(cell.load(std::memory_order_relaxed) + delta,
+             std::memory_order_relaxed);
+}
+
+auto Load(const Cell& cell) -> uint64_t {
+  return cell.load(std::memory_order_relaxed);
+}
+
+auto Clear(Cell& cell) -> void { cell.store(0, std::memory_order_relaxed); }
+
+auto BucketIndex(uint64_t nanoseconds) -> std::size_t {
+  if (nanoseconds == 0) {
+    return 0;
+  }
+#if defined(__GNUC__) || defined(__clang__)
+  const auto bits{static_cast<std::size_t>(64 - __builtin_clzll(nanoseconds))};
+#else
+  std::size_t bits{0};
+  for (auto value{nanoseconds}; value != 0; value >>= 1U) {
+    ++bits;
+  }
+#endif
+  return std::min(bits, geometry::instrumentation::kHistogramBucketCount - 1);
+}
+
+/**
+ * @brief Process wide list of live thread blocks plus the totals of threads
+ * which already exited. The mutex is only taken on thread start and exit and
+ * by snapshot readers, never on the counting path.
+ */
+struct Registry {
+  std::mutex mutex;
+  std::vector<ThreadBlock*> live;
+  ThreadBlock retired;
+  std::atomic<int> marker_fd{-1};
+};
+
+auto GetRegistry() -> Registry& {
+  static Registry registry;
+  return registry;
+}
+
+auto ForEachCell(ThreadBlock& block, void (*visit)(Cell&, Cell&),
+                 ThreadBlock& other) -> void {
+  for (std::size_t i = 0; i < geometry::instrumentation::kProbeCount; ++i) {
+    visit(block.counts[i], other.counts[i]);
+    visit(block.samples[i], other.samples[i]);
+    visit(block.total_ns[i], other.total_ns[i]);
+    for (std::size_t j = 0; j < geometry::instrumentation::kHistogramBucketCount;
+         ++j) {
+      visit(block.buckets[i][j], other.buckets[i][j]);
+    }
+  }
+}
+
+/**
+ * @brief Thread local owner of a block, registering it on first use and
+ * folding it into the retired totals on thread exit.
+ */
+class ThreadSlot {
+ public:
+  ThreadSlot() : registry_(GetRegistry()) {
+    const std::lock_guard<std::mutex> lock(registry_.mutex);
+    registry_.live.push_back(&block_);
+  }
+
+  ThreadSlot(const ThreadSlot& other) = delete;
+  ThreadSlot(ThreadSlot&& other) = delete;
+  auto operator=(const ThreadSlot& other) -> ThreadSlot& = delete;
+  auto operator=(ThreadSlot&& other) -> ThreadSlot& = delete;
+
+  ~ThreadSlot() {
+    const std::lock_guard<std::mutex> lock(registry_.mutex);
+    ForEachCell(
+        registry_.retired,
+        [](Cell& retired, Cell& own) { Bump(retired, Load(own)); }, block_);
+    registry_.live.erase(
+        std::remove(registry_.live.begin(), registry_.live.end(), &block_),
+        registry_.live.end());
+  }
+
+  auto GetBlock() -> ThreadBlock& { return block_; }
+
+ private:
+  Registry& registry_;
+  ThreadBlock block_;
+};
+
+auto GetThreadBlock() -> ThreadBlock& {
+  thread_local ThreadSlot slot;
+  return slot.GetBlock();
+}
+
+auto WriteMarker(geometry::instrumentation::Probe probe, const char* phase)
+    -> void {
+#ifdef __linux__
+  const int descriptor{
+      GetRegistry().marker_fd.load(std::memory_order_relaxed)};
+  if (descriptor < 0) {
+    return;
+  }
+  std::string message{"geometry:"};
+  message += phase;
+  message += ' ';
+  message += geometry::instrumentation::GetProbeName(probe);
+  static_cast<void>(::write(descriptor, message.data(), message.size()));
+#else
+  static_cast<void>(probe);
+  static_cast<void>(phase);
+#endif
+}
+#endif
+}  // namespace
+
+namespace geometry {
+namespace instrumentation {
+
+auto GetProbeName(Probe probe) -> const char* {
+  const auto index{static_cast<std::size_t>(probe)};
+  if (index >= kProbeCount) {
+    return "unknown";
+  }
+  return kProbeNames.at(index);
+}
+
+auto ProbeSnapshot::GetQuantile(double quantile) const -> uint64_t {
+  if (samples == 0) {
+    return 0;
+  }
+  const auto clamped{std::clamp(quantile, 0.0, 1.0)};
+  const auto rank{static_cast<uint64_t>(clamped *
+                                        static_cast<double>(samples - 1)) +
+                  1};
+  uint64_t seen{0};
+  for (std::size_t i = 0; i < kHistogramBucketCount; ++i) {
+    seen += buckets.at(i);
+    if (seen >= rank) {
+      return (i == 0) ? 0 : (uint64_t{1} << i);
+    }
+  }
+  return uint64_t{1} << (kHistogramBucketCount - 1);
+}
+
+auto Snapshot::Get(Probe probe) const -> const ProbeSnapshot& {
+  return probes.at(static_cast<std::size_t>(probe));
+}
+
+auto Snapshot::ToText() const -> std::string {
+  std::ostringstream stream;
+  for (std::size_t i = 0; i < kProbeCount; ++i) {
+    const auto& probe{probes.at(i)};
+    stream << kProbeNames.at(i) << " count=" << probe.count
+           << " samples=" << probe.samples << " total_ns=" << probe.total_ns
+           << " p50_ns=" << probe.GetQuantile(kMedian)
+           << " p99_ns=" << probe.GetQuantile(kPercentile99)
+           << " p999_ns=" << probe.GetQuantile(kPercentile999) << '\n';
+  }
+  return stream.str();
+}
+
+auto Snapshot::ToJson() const -> std::string {
+  std::ostringstream stream;
+  stream << "{\"enabled\":" << (kEnabled ? "true" : "false")
+         << ",\"probes\":{";
+  for (std::size_t i = 0; i < kProbeCount; ++i) {
+    const auto& probe{probes.at(i)};
+    stream << (i == 0 ? "" : ",") << '"' << kProbeNames.at(i) << "\":{"
+           << "\"count\":" << probe.count << ",\"samples\":" << probe.samples
+           << ",\"total_ns\":" << probe.total_ns
+           << ",\"p50_ns\":" << probe.GetQuantile(kMedian)
+           << ",\"p99_ns\":" << probe.GetQuantile(kPercentile99)
+           << ",\"p999_ns\":" << probe.GetQuantile(kPercentile999)
+           << ",\"buckets\":[";
+    for (std::size_t j = 0; j < kHistogramBucketCount; ++j) {
+      stream << (j == 0 ? "" : ",") << probe.buckets.at(j);
+    }
+    stream << "]}";
+  }
+  stream << "}}";
+  return stream.str();
+}
+
+auto TakeSnapshot() -> Snapshot {
+  Snapshot result;
+#ifdef GEOMETRY_ENABLE_INSTRUMENTATION
+  auto& registry{GetRegistry()};
+  const std::lock_guard<std::mutex> lock(registry.mutex);
+  auto accumulate{[&result](const ThreadBlock& block) {
+    for (std::size_t i = 0; i < kProbeCount; ++i) {
+      auto& probe{result.probes.at(i)};
+      probe.count += Load(block.counts.at(i));
+      probe.samples += Load(block.samples.at(i));
+      probe.total_ns += Load(block.total_ns.at(i));
+      for (std::size_t j = 0; j < kHistogramBucketCount; ++j) {
+        probe.buckets.at(j) += Load(block.buckets.at(i).at(j));
+      }
+    }
+  }};
+  accumulate(registry.retired);
+  for (const auto* block : registry.live) {
+    accumulate(*block);
+  }
+#endif
+  return result;
+}
+
+auto Reset() -> void {
+#ifdef GEOMETRY_ENABLE_INSTRUMENTATION
+  auto& registry{GetRegistry()};
+  const std::lock_guard<std::mutex> lock(registry.mutex);
+  auto clear{[](Cell& cell, Cell& /*unused*/) { Clear(cell); }};
+  ForEachCell(registry.retired, clear, registry.retired);
+  for (auto* block : registry.live) {
+    ForEachCell(*block, clear, *block);
+  }
+#endif
+}
+
+auto EnablePerfMarkers(bool enable) -> bool {
+#if defined(GEOMETRY_ENABLE_INSTRUMENTATION) && defined(__linux__)
+  auto& registry{GetRegistry()};
+  const std::lock_guard<std::mutex> lock(registry.mutex);
+  const int previous{registry.marker_fd.exchange(-1)};
+  if (previous >= 0) {
+    ::close(previous);
+  }
+  if (!enable) {
+    return false;
+  }
+  for (const char* path : {"/sys/kernel/tracing/trace_marker",
+                           "/sys/kernel/debug/tracing/trace_marker"}) {
+    const int descriptor{::open(path, O_WRONLY | O_CLOEXEC)};
+    if (descriptor >= 0) {
+      registry.marker_fd.store(descriptor);
+      return true;
+    }
+  }
+  return false;
+#else
+  static_cast<void>(enable);
+  return false;
+#endif
+}
+
+auto Count(Probe probe) -> void {
+#ifdef GEOMETRY_ENABLE_INSTRUMENTATION
+  Bump(GetThreadBlock().counts.at(static_cast<std::size_t>(probe)), 1);
+#else
+  static_cast<void>(probe);
+#endif
+}
+
+auto Record(Probe probe, uint64_t nanoseconds) -> void {
+#ifdef GEOMETRY_ENABLE_INSTRUMENTATION
+  const auto index{static_cast<std::size_t>(probe)};
+  auto& block{GetThreadBlock()};
+  Bump(block.counts.at(index), 1);
+  Bump(block.samples.at(index), 1);
+  Bump(block.total_ns.at(index), nanoseconds);
+  Bump(block.buckets.at(index).at(BucketIndex(nanoseconds)), 1);
+#else
+  static_cast<void>(probe);
+  static_cast<void>(nanoseconds);
+#endif
+}
+
+ScopedTimer::ScopedTimer(Probe probe)
+    : probe_(probe), start_(std::chrono::steady_clock::now()) {
+#ifdef GEOMETRY_ENABLE_INSTRUMENTATION
+  WriteMarker(probe_, "begin");
+#endif
+}
+
+ScopedTimer::~ScopedTimer() {
+  const auto elapsed{std::chrono::steady_clock::now() - start_};
+  Record(probe_, static_cast<uint64_t>(
+                     std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         elapsed)
+                         .count()));
+#ifdef GEOMETRY_ENABLE_INSTRUMENTATION
+  WriteMarker(probe_, "end");
+#endif
+}
+
+}  // namespace instrumentation
+}  // namespace geometry
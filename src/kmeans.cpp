@@ -0,0 +1,375 @@
+/**
+ * @file geometry/kmeans.cpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief k-means clustering with bound pruning and mini-batch updates
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/kmeans.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+
+#include "detail/parallel.hpp"
+#include "geometry/instrumentation.hpp"
+
+namespace {
+constexpr double kInfinity{std::numeric_limits<double>::infinity()};
+
+/**
+ * @brief Nearest and second nearest centroid of a point, squared distances.
+ */
+struct NearestTwo {
+  uint32_t index{0};
+  double first{kInfinity};
+  double second{kInfinity};
+};
+
+/**
+ * @brief Squared distances to every centroid, written branch-free over the
+ * structure-of-arrays centroids so the compiler can vectorise the loop.
+ */
+auto FindNearestTwo(const double* centroid_xs, const double* centroid_ys,
+                    std::size_t k, double x, double y, double* scratch)
+    -> NearestTwo {
+  for (std::size_t j = 0; j < k; ++j) {
+    const double dx{centroid_xs[j] - x};
+    const double dy{centroid_ys[j] - y};
+    scratch[j] = (dx * dx) + (dy * dy);
+  }
+  NearestTwo result;
+  for (std::size_t j = 0; j < k; ++j) {
+    const double squared{scratch[j]};
+    if (squared < result.first) {
+      result.second = result.first;
+      result.first = squared;
+      result.index = static_cast<uint32_t>(j);
+    } else if (squared < result.second) {
+      result.second = squared;
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Split [0, count) into one fixed chunk per worker, so reductions are
+ * summed in the same order on every run.
+ */
+auto GetChunkSize(std::size_t count, std::size_t thread_count) -> std::size_t {
+  const std::size_t workers{geometry::detail::ResolveThreadCount(thread_count)};
+  return std::max<std::size_t>(1, (count + workers - 1) / workers);
+}
+
+/**
+ * @brief Pick k seeds with k-means++ D^2 sampling.
+ */
+auto SeedPlusPlus(const std::vector<double>& xs, const std::vector<double>& ys,
+                  std::size_t k, uint64_t seed, std::size_t thread_count,
+                  std::vector<double>& centroid_xs,
+                  std::vector<double>& centroid_ys) -> void {
+  const std::size_t count{xs.size()};
+  const std::size_t chunk_size{GetChunkSize(count, thread_count)};
+  const std::size_t chunk_count{(count + chunk_size - 1) / chunk_size};
+  std::mt19937_64 engine(seed);
+  std::vector<double> nearest(count, kInfinity);
+  std::vector<double> chunk_sums(chunk_count, 0.0);
+
+  centroid_xs.clear();
+  centroid_ys.clear();
+  std::size_t chosen{std::uniform_int_distribution<std::size_t>(
+      0, count - 1)(engine)};
+  for (;;) {
+    const double chosen_x{xs[chosen]};
+    const double chosen_y{ys[chosen]};
+    centroid_xs.push_back(chosen_x);
+    centroid_ys.push_back(chosen_y);
+    if (centroid_xs.size() == k) {
+      return;
+    }
+
+    geometry::detail::ParallelFor(
+        count, chunk_size, thread_count,
+        [&](std::size_t begin, std::size_t end, std::size_t /*worker*/) {
+          double sum{0.0};
+          for (std::size_t i = begin; i < end; ++i) {
+            const double dx{xs[i] - chosen_x};
+            const double dy{ys[i] - chosen_y};
+            nearest[i] = std::min(nearest[i], (dx * dx) + (dy * dy));
+            sum += nearest[i];
+          }
+          chunk_sums[begin / chunk_size] = sum;
+        });
+
+    double total{0.0};
+    for (const double sum : chunk_sums) {
+      total += sum;
+    }
+    if (!(total > 0.0)) {
+      // Every point coincides with a seed, duplicates are the only choice.
+      chosen = std::uniform_int_distribution<std::size_t>(0, count - 1)(engine);
+      continue;
+    }
+    double target{std::uniform_real_distribution<double>(0.0, total)(engine)};
+    std::size_t chunk{0};
+    while (chunk + 1 < chunk_count && target >= chunk_sums[chunk]) {
+      target -= chunk_sums[chunk];
+      ++chunk;
+    }
+    const std::size_t end{std::min(count, (chunk + 1) * chunk_size)};
+    chosen = end - 1;
+    for (std::size_t i = chunk * chunk_size; i < end; ++i) {
+      if (nearest[i] > 0.0 && target < nearest[i]) {
+        chosen = i;
+        break;
+      }
+      target -= nearest[i];
+    }
+  }
+}
+
+/**
+ * @brief Per chunk partial sums of an assignment pass.
+ */
+struct Partial {
+  std::vector<double> sum_x;
+  std::vector<double> sum_y;
+  std::vector<uint64_t> count;
+  std::vector<double> scratch;
+  uint64_t evaluations{0};
+  std::size_t changed{0};
+
+  auto Reset(std::size_t k) -> void {
+    sum_x.assign(k, 0.0);
+    sum_y.assign(k, 0.0);
+    count.assign(k, 0);
+    scratch.resize(k);
+    evaluations = 0;
+    changed = 0;
+  }
+};
+}  // namespace
+
+namespace geometry {
+
+auto KMeans(const std::vector<Point2D>& points, const KMeansOptions& options)
+    -> KMeansResult {
+  GEOMETRY_INSTRUMENT_SCOPE(kKMeans);
+  const std::size_t k{options.k};
+  const std::size_t count{points.size()};
+  if (k == 0 || k > count) {
+    throw std::invalid_argument("Invalid input: k must be in [1, points]");
+  }
+
+  std::vector<double> xs(count);
+  std::vector<double> ys(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    xs[i] = points[i].GetX();
+    ys[i] = points[i].GetY();
+  }
+
+  std::vector<double> centroid_xs;
+  std::vector<double> centroid_ys;
+  SeedPlusPlus(xs, ys, k, options.seed, options.thread_count, centroid_xs,
+               centroid_ys);
+
+  const std::size_t chunk_size{GetChunkSize(count, options.thread_count)};
+  std::vector<Partial> partials((count + chunk_size - 1) / chunk_size);
+  std::vector<uint32_t> labels(count, 0);
+  std::vector<double> upper(count, kInfinity);
+  std::vector<double> lower(count, 0.0);
+  std::vector<double> half_gap(k, 0.0);
+  std::vector<double> moves(k, 0.0);
+  KMeansResult result;
+
+  // Hamerly: a point keeps its centroid while its upper bound to it does not
+  // exceed both the lower bound to every other centroid and half the gap to
+  // the nearest other centroid.
+  auto assign{[&](bool full) {
+    detail::ParallelFor(
+        count, chunk_size, options.thread_count,
+        [&](std::size_t begin, std::size_t end, std::size_t /*worker*/) {
+          auto& partial{partials[begin / chunk_size]};
+          partial.Reset(k);
+          for (std::size_t i = begin; i < end; ++i) {
+            uint32_t label{labels[i]};
+            const double bound{std::max(half_gap[label], lower[i])};
+            if (full || upper[i] > bound) {
+              if (!full) {
+                const double dx{xs[i] - centroid_xs[label]};
+                const double dy{ys[i] - centroid_ys[label]};
+                upper[i] = std::sqrt((dx * dx) + (dy * dy));
+                ++partial.evaluations;
+              }
+              if (full || upper[i] > bound) {
+                const auto nearest{FindNearestTwo(
+                    centroid_xs.data(), centroid_ys.data(), k, xs[i], ys[i],
+                    partial.scratch.data())};
+                partial.evaluations += k;
+                upper[i] = std::sqrt(nearest.first);
+                lower[i] = std::sqrt(nearest.second);
+                if (full || nearest.index != label) {
+                  label = nearest.index;
+                  labels[i] = label;
+                  ++partial.changed;
+                }
+              }
+            }
+            partial.sum_x[label] += xs[i];
+            partial.sum_y[label] += ys[i];
+            ++partial.count[label];
+          }
+        });
+    std::size_t changed{0};
+    for (const auto& partial : partials) {
+      changed += partial.changed;
+      result.distance_evaluations += partial.evaluations;
+    }
+    return changed;
+  }};
+
+  const double tolerance{options.tolerance.GetValue(Distance::Type::kMeter)};
+  std::size_t changed{assign(true)};
+  for (;;) {
+    double largest{0.0};
+    double second_largest{0.0};
+    std::size_t largest_index{0};
+    for (std::size_t j = 0; j < k; ++j) {
+      double sum_x{0.0};
+      double sum_y{0.0};
+      uint64_t members{0};
+      for (const auto& partial : partials) {
+        sum_x += partial.sum_x[j];
+        sum_y += partial.sum_y[j];
+        members += partial.count[j];
+      }
+      moves[j] = 0.0;
+      if (members != 0) {
+        const double next_x{sum_x / static_cast<double>(members)};
+        const double next_y{sum_y / static_cast<double>(members)};
+        moves[j] = std::hypot(next_x - centroid_xs[j], next_y - centroid_ys[j]);
+        centroid_xs[j] = next_x;
+        centroid_ys[j] = next_y;
+      }
+      if (moves[j] > largest) {
+        second_largest = largest;
+        largest = moves[j];
+        largest_index = j;
+      } else if (moves[j] > second_largest) {
+        second_largest = moves[j];
+      }
+    }
+    ++result.iterations;
+    if (changed == 0 || largest <= tolerance ||
+        result.iterations >= options.max_iterations) {
+      break;
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+      upper[i] += moves[labels[i]];
+      lower[i] -= (labels[i] == largest_index) ? second_largest : largest;
+    }
+    for (std::size_t j = 0; j < k; ++j) {
+      double gap{kInfinity};
+      for (std::size_t other = 0; other < k; ++other) {
+        if (other != j) {
+          gap = std::min(gap, std::hypot(centroid_xs[j] - centroid_xs[other],
+                                         centroid_ys[j] - centroid_ys[other]));
+        }
+      }
+      half_gap[j] = 0.5 * gap;
+    }
+    changed = assign(false);
+  }
+
+  result.centroids.reserve(k);
+  for (std::size_t j = 0; j < k; ++j) {
+    result.centroids.emplace_back(centroid_xs[j], centroid_ys[j]);
+  }
+  for (std::size_t i = 0; i < count; ++i) {
+    const double dx{xs[i] - centroid_xs[labels[i]]};
+    const double dy{ys[i] - centroid_ys[labels[i]]};
+    result.inertia += (dx * dx) + (dy * dy);
+  }
+  result.labels = std::move(labels);
+  return result;
+}
+
+MiniBatchKMeans::MiniBatchKMeans(const KMeansOptions& options)
+    : options_(options) {
+  if (options_.k == 0) {
+    throw std::invalid_argument("Invalid input: k must be positive");
+  }
+}
+
+auto MiniBatchKMeans::Update(const Point2D* points, std::size_t count)
+    -> void {
+  GEOMETRY_INSTRUMENT_SCOPE(kKMeans);
+  if (count == 0) {
+    return;
+  }
+  const std::size_t k{options_.k};
+  std::vector<double> xs(count);
+  std::vector<double> ys(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    xs[i] = points[i].GetX();
+    ys[i] = points[i].GetY();
+  }
+  if (xs_.empty()) {
+    if (count < k) {
+      throw std::invalid_argument("Invalid input: First batch smaller than k");
+    }
+    SeedPlusPlus(xs, ys, k, options_.seed, options_.thread_count, xs_, ys_);
+    counts_.assign(k, 0);
+  }
+
+  std::vector<uint32_t> labels(count);
+  detail::ParallelFor(
+      count, GetChunkSize(count, options_.thread_count), options_.thread_count,
+      [&](std::size_t begin, std::size_t end, std::size_t /*worker*/) {
+        std::vector<double> scratch(k);
+        for (std::size_t i = begin; i < end; ++i) {
+          labels[i] = FindNearestTwo(xs_.data(), ys_.data(), k, xs[i], ys[i],
+                                     scratch.data())
+                          .index;
+        }
+      });
+  for (std::size_t i = 0; i < count; ++i) {
+    const uint32_t label{labels[i]};
+    const double rate{1.0 / static_cast<double>(++counts_[label])};
+    xs_[label] += rate * (xs[i] - xs_[label]);
+    ys_[label] += rate * (ys[i] - ys_[label]);
+  }
+}
+
+auto MiniBatchKMeans::Update(const std::vector<Point2D>& points) -> void {
+  Update(points.data(), points.size());
+}
+
+auto MiniBatchKMeans::Predict(const Point2D& point) const -> uint32_t {
+  if (xs_.empty()) {
+    throw std::logic_error("Invalid state: No batch folded in yet");
+  }
+  std::vector<double> scratch(xs_.size());
+  return FindNearestTwo(xs_.data(), ys_.data(), xs_.size(), point.GetX(),
+                        point.GetY(), scratch.data())
+      .index;
+}
+
+auto MiniBatchKMeans::GetCentroids() const -> std::vector<Point2D> {
+  std::vector<Point2D> centroids;
+  centroids.reserve(xs_.size());
+  for (std::size_t j = 0; j < xs_.size(); ++j) {
+    centroids.emplace_back(xs_[j], ys_[j]);
+  }
+  return centroids;
+}
+
+}  // namespace geometry
@@ -0,0 +1,222 @@
+/**
+ * @file geometry/knn_join.cpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Batch k-nearest-neighbour join between two Point2D sets
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/knn_join.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+#include "detail/parallel.hpp"
+#include "geometry/instrumentation.hpp"
+
+namespace {
+using Candidate = std::pair<double, uint32_t>;  ///< Squared distance, index
+
+constexpr double kInfinity{std::numeric_limits<double>::infinity()};
+
+/**
+ * @brief Interleave the low 32 bits of column and row into a Z-order key.
+ */
+auto InterleaveCells(uint64_t column, uint64_t row) -> uint64_t {
+  auto spread{[](uint64_t value) {
+    value &= 0x00000000FFFFFFFFULL;
+    value = (value | (value << 16U)) & 0x0000FFFF0000FFFFULL;
+    value = (value | (value << 8U)) & 0x00FF00FF00FF00FFULL;
+    value = (value | (value << 4U)) & 0x0F0F0F0F0F0F0F0FULL;
+    value = (value | (value << 2U)) & 0x3333333333333333ULL;
+    value = (value | (value << 1U)) & 0x5555555555555555ULL;
+    return value;
+  }};
+  return spread(column) | (spread(row) << 1U);
+}
+
+/**
+ * @brief Bounded sorted list of the best candidates of one query.
+ */
+class NearestList {
+ public:
+  explicit NearestList(std::size_t k) : capacity_(k) { items_.reserve(k); }
+
+  auto Clear() -> void { items_.clear(); }
+
+  auto IsFull() const -> bool { return items_.size() == capacity_; }
+
+  auto GetWorst() const -> double {
+    return IsFull() ? items_.back().first : kInfinity;
+  }
+
+  auto Offer(double squared, uint32_t index) -> void {
+    const Candidate candidate{squared, index};
+    if (IsFull()) {
+      if (!(candidate < items_.back())) {
+        return;
+      }
+      items_.pop_back();
+    }
+    items_.insert(std::upper_bound(items_.begin(), items_.end(), candidate),
+                  candidate);
+  }
+
+  auto GetItems() const -> const std::vector<Candidate>& { return items_; }
+
+ private:
+  std::size_t capacity_;
+  std::vector<Candidate> items_;
+};
+
+/**
+ * @brief Scan the cells [first_column, last_column] of one row.
+ */
+auto ScanRow(const geometry::GridIndex& grid, std::size_t row,
+             std::size_t first_column, std::size_t last_column, double x,
+             double y, NearestList& nearest) -> void {
+  const auto& xs{grid.GetXs()};
+  const auto& ys{grid.GetYs()};
+  const auto& indices{grid.GetIndices()};
+  const std::size_t end{grid.GetCellEnd(last_column, row)};
+  for (std::size_t slot = grid.GetCellBegin(first_column, row); slot < end;
+       ++slot) {
+    const double dx{xs[slot] - x};
+    const double dy{ys[slot] - y};
+    const double squared{(dx * dx) + (dy * dy)};
+    if (squared <= nearest.GetWorst()) {
+      nearest.Offer(squared, indices[slot]);
+    }
+  }
+}
+
+/**
+ * @brief Search rings of cells around the query cell until no unvisited cell
+ * can hold a closer point than the current k-th neighbour.
+ */
+auto SearchNearest(const geometry::GridIndex& grid, double x, double y,
+                   NearestList& nearest) -> void {
+  const auto columns{static_cast<std::ptrdiff_t>(grid.GetColumnCount())};
+  const auto rows{static_cast<std::ptrdiff_t>(grid.GetRowCount())};
+  const auto column{static_cast<std::ptrdiff_t>(grid.GetColumn(x))};
+  const auto row{static_cast<std::ptrdiff_t>(grid.GetRow(y))};
+  const double cell_size{grid.GetCellSize()};
+  auto edge_x{[&grid, cell_size](std::ptrdiff_t edge) {
+    return grid.GetMinX() + (static_cast<double>(edge) * cell_size);
+  }};
+  auto edge_y{[&grid, cell_size](std::ptrdiff_t edge) {
+    return grid.GetMinY() + (static_cast<double>(edge) * cell_size);
+  }};
+
+  nearest.Clear();
+  for (std::ptrdiff_t ring = 0;; ++ring) {
+    const auto first_column{std::max<std::ptrdiff_t>(0, column - ring)};
+    const auto last_column{std::min(columns - 1, column + ring)};
+    const auto first_row{std::max<std::ptrdiff_t>(0, row - ring)};
+    const auto last_row{std::min(rows - 1, row + ring)};
+
+    for (std::ptrdiff_t current = first_row; current <= last_row; ++current) {
+      const auto current_row{static_cast<std::size_t>(current)};
+      if (current == row - ring || current == row + ring) {
+        ScanRow(grid, current_row, static_cast<std::size_t>(first_column),
+                static_cast<std::size_t>(last_column), x, y, nearest);
+        continue;
+      }
+      if (column - ring >= 0) {
+        const auto left{static_cast<std::size_t>(column - ring)};
+        ScanRow(grid, current_row, left, left, x, y, nearest);
+      }
+      if (ring != 0 && column + ring < columns) {
+        const auto right{static_cast<std::size_t>(column + ring)};
+        ScanRow(grid, current_row, right, right, x, y, nearest);
+      }
+    }
+
+    // Distance from the query to the nearest cell outside the visited block.
+    double bound{kInfinity};
+    if (column - ring > 0) {
+      bound = std::min(bound, x - edge_x(column - ring));
+    }
+    if (column + ring < columns - 1) {
+      bound = std::min(bound, edge_x(column + ring + 1) - x);
+    }
+    if (row - ring > 0) {
+      bound = std::min(bound, y - edge_y(row - ring));
+    }
+    if (row + ring < rows - 1) {
+      bound = std::min(bound, edge_y(row + ring + 1) - y);
+    }
+    if (bound == kInfinity) {
+      return;
+    }
+    if (nearest.IsFull() && bound >= 0.0 &&
+        nearest.GetWorst() <= bound * bound) {
+      return;
+    }
+  }
+}
+}  // namespace
+
+namespace geometry {
+
+auto KnnJoin(const std::vector<Point2D>& queries,
+             const std::vector<Point2D>& references,
+             const KnnJoinOptions& options) -> KnnJoinResult {
+  return KnnJoin(queries, GridIndex(references), options);
+}
+
+auto KnnJoin(const std::vector<Point2D>& queries, const GridIndex& references,
+             const KnnJoinOptions& options) -> KnnJoinResult {
+  GEOMETRY_INSTRUMENT_SCOPE(kKnnJoin);
+  if (options.k == 0) {
+    throw std::invalid_argument("Invalid input: k must be positive");
+  }
+  if (queries.size() >= std::numeric_limits<uint32_t>::max()) {
+    throw std::invalid_argument("Invalid input: Too many points");
+  }
+
+  const std::size_t k{options.k};
+  KnnJoinResult result;
+  result.k = k;
+  result.indices.assign(queries.size() * k, KnnJoinResult::kInvalidIndex);
+  result.distances.assign(queries.size() * k, Distance());
+  if (queries.empty() || references.GetSize() == 0) {
+    return result;
+  }
+
+  // Visit queries in Z-order of their reference cell so consecutive queries
+  // of a batch reuse the same cache-resident candidate cells.
+  std::vector<std::pair<uint64_t, uint32_t>> order(queries.size());
+  for (std::size_t i = 0; i < queries.size(); ++i) {
+    order[i] = {InterleaveCells(references.GetColumn(queries[i].GetX()),
+                                references.GetRow(queries[i].GetY())),
+                static_cast<uint32_t>(i)};
+  }
+  std::sort(order.begin(), order.end());
+
+  detail::ParallelFor(
+      order.size(), options.batch_size, options.thread_count,
+      [&](std::size_t begin, std::size_t end, std::size_t /*worker*/) {
+        NearestList nearest(k);
+        for (std::size_t position = begin; position < end; ++position) {
+          const std::size_t query{order[position].second};
+          SearchNearest(references, queries[query].GetX(),
+                        queries[query].GetY(), nearest);
+          const auto& items{nearest.GetItems()};
+          for (std::size_t rank = 0; rank < items.size(); ++rank) {
+            result.indices[(query * k) + rank] = items[rank].second;
+            result.distances[(query * k) + rank] =
+                Distance(std::sqrt(items[rank].first), Distance::Type::kMeter);
+          }
+        }
+      });
+  return result;
+}
+
+}  // namespace geometry
@@ -0,0 +1,235 @@
+/**
+ * @file geometry/polyline_distance.cpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Hausdorff and discrete Frechet distances between Point2D sequences
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/polyline_distance.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+#include "geometry/instrumentation.hpp"
+
+namespace {
+constexpr double kInfinity{std::numeric_limits<double>::infinity()};
+constexpr uint32_t kShuffleSeed{0x5EEDU};
+
+/**
+ * @brief Coordinates of a sequence in a fixed pseudo-random order. Random
+ * order makes an early break likely after a few candidates even on
+ * trajectories, where input order correlates neighbouring points.
+ */
+struct ShuffledPoints {
+  std::vector<double> xs;
+  std::vector<double> ys;
+
+  explicit ShuffledPoints(const std::vector<geometry::Point2D>& points)
+      : xs(points.size()), ys(points.size()) {
+    std::vector<std::size_t> order(points.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), std::mt19937(kShuffleSeed));
+    for (std::size_t i = 0; i < order.size(); ++i) {
+      xs[i] = points[order[i]].GetX();
+      ys[i] = points[order[i]].GetY();
+    }
+  }
+};
+
+auto CheckNotEmpty(const std::vector<geometry::Point2D>& lhs,
+                   const std::vector<geometry::Point2D>& rhs) -> void {
+  if (lhs.empty() || rhs.empty()) {
+    throw std::invalid_argument("Invalid input: Empty sequence");
+  }
+}
+
+auto SquaredDistance(const geometry::Point2D& lhs,
+                     const geometry::Point2D& rhs) -> double {
+  const double dx{lhs.GetX() - rhs.GetX()};
+  const double dy{lhs.GetY() - rhs.GetY()};
+  return (dx * dx) + (dy * dy);
+}
+
+/**
+ * @brief Directed squared Hausdorff distance, never below running_max.
+ */
+auto DirectedHausdorff(const ShuffledPoints& from, const ShuffledPoints& to,
+                       double running_max) -> double {
+  const std::size_t to_count{to.xs.size()};
+  for (std::size_t i = 0; i < from.xs.size(); ++i) {
+    const double x{from.xs[i]};
+    const double y{from.ys[i]};
+    double nearest{kInfinity};
+    for (std::size_t j = 0; j < to_count; ++j) {
+      const double dx{to.xs[j] - x};
+      const double dy{to.ys[j] - y};
+      nearest = std::min(nearest, (dx * dx) + (dy * dy));
+      if (nearest < running_max) {
+        break;
+      }
+    }
+    running_max = std::max(running_max, nearest);
+  }
+  return running_max;
+}
+
+/**
+ * @brief Whether every point of from has a partner in to within the squared
+ * threshold. The search for a partner widens outwards from the partner of the
+ * previous point, which is found within a few steps on trajectories.
+ */
+auto IsDirectedHausdorffWithin(const std::vector<geometry::Point2D>& from,
+                               const std::vector<geometry::Point2D>& to,
+                               double squared_threshold) -> bool {
+  const std::size_t to_count{to.size()};
+  std::size_t hint{0};
+  for (const auto& point : from) {
+    const std::size_t widest{std::max(hint, to_count - 1 - hint)};
+    bool matched{false};
+    for (std::size_t offset = 0; offset <= widest && !matched; ++offset) {
+      if (hint + offset < to_count &&
+          SquaredDistance(point, to[hint + offset]) <= squared_threshold) {
+        hint += offset;
+        matched = true;
+      } else if (offset != 0 && offset <= hint &&
+                 SquaredDistance(point, to[hint - offset]) <=
+                     squared_threshold) {
+        hint -= offset;
+        matched = true;
+      }
+    }
+    if (!matched) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+namespace geometry {
+
+auto CalculateHausdorffDistance(const std::vector<Point2D>& lhs,
+                                const std::vector<Point2D>& rhs) -> Distance {
+  GEOMETRY_INSTRUMENT_SCOPE(kPolylineDistance);
+  CheckNotEmpty(lhs, rhs);
+  const ShuffledPoints lhs_points(lhs);
+  const ShuffledPoints rhs_points(rhs);
+  double squared{DirectedHausdorff(lhs_points, rhs_points, 0.0)};
+  squared = DirectedHausdorff(rhs_points, lhs_points, squared);
+  return Distance(std::sqrt(squared), Distance::Type::kMeter);
+}
+
+auto IsHausdorffDistanceWithin(const std::vector<Point2D>& lhs,
+                               const std::vector<Point2D>& rhs,
+                               const Distance& threshold) -> bool {
+  GEOMETRY_INSTRUMENT_SCOPE(kPolylineDistance);
+  CheckNotEmpty(lhs, rhs);
+  const double range{threshold.GetValue(Distance::Type::kMeter)};
+  if (range < 0.0) {
+    return false;
+  }
+  return IsDirectedHausdorffWithin(lhs, rhs, range * range) &&
+         IsDirectedHausdorffWithin(rhs, lhs, range * range);
+}
+
+auto CalculateDiscreteFrechetDistance(const std::vector<Point2D>& lhs,
+                                      const std::vector<Point2D>& rhs)
+    -> Distance {
+  GEOMETRY_INSTRUMENT_SCOPE(kPolylineDistance);
+  CheckNotEmpty(lhs, rhs);
+  const std::size_t columns{rhs.size()};
+
+  // row[j] holds the squared coupling distance of (i, j) for the current i.
+  std::vector<double> row(columns);
+  row[0] = SquaredDistance(lhs[0], rhs[0]);
+  for (std::size_t j = 1; j < columns; ++j) {
+    row[j] = std::max(row[j - 1], SquaredDistance(lhs[0], rhs[j]));
+  }
+  for (std::size_t i = 1; i < lhs.size(); ++i) {
+    double diagonal{row[0]};
+    row[0] = std::max(row[0], SquaredDistance(lhs[i], rhs[0]));
+    for (std::size_t j = 1; j < columns; ++j) {
+      const double up{row[j]};
+      const double best{std::min({up, diagonal, row[j - 1]})};
+      diagonal = up;
+      row[j] = std::max(best, SquaredDistance(lhs[i], rhs[j]));
+    }
+  }
+  return Distance(std::sqrt(row[columns - 1]), Distance::Type::kMeter);
+}
+
+auto IsDiscreteFrechetDistanceWithin(const std::vector<Point2D>& lhs,
+                                     const std::vector<Point2D>& rhs,
+                                     const Distance& threshold) -> bool {
+  GEOMETRY_INSTRUMENT_SCOPE(kPolylineDistance);
+  CheckNotEmpty(lhs, rhs);
+  const double range{threshold.GetValue(Distance::Type::kMeter)};
+  if (range < 0.0) {
+    return false;
+  }
+  const double squared_threshold{range * range};
+  auto within{[&](std::size_t i, std::size_t j) {
+    return SquaredDistance(lhs[i], rhs[j]) <= squared_threshold;
+  }};
+  const std::size_t columns{rhs.size()};
+  if (!within(0, 0) || !within(lhs.size() - 1, columns - 1)) {
+    return false;
+  }
+
+  // Reachable cells of a row lie in the band [first, last], and the band of
+  // a row never starts left of the band of the previous row.
+  std::vector<uint8_t> previous(columns, 0);
+  std::vector<uint8_t> current(columns, 0);
+  std::size_t first{0};
+  std::size_t last{0};
+  previous[0] = 1;
+  while (last + 1 < columns && within(0, last + 1)) {
+    previous[++last] = 1;
+  }
+
+  for (std::size_t i = 1; i < lhs.size(); ++i) {
+    std::size_t next_first{columns};
+    std::size_t next_last{0};
+    bool left{false};
+    for (std::size_t j = first; j < columns; ++j) {
+      const bool up{j <= last && previous[j] != 0};
+      const bool diagonal{j > first && j - 1 <= last && previous[j - 1] != 0};
+      if (!up && !diagonal && !left) {
+        if (j > last) {
+          break;
+        }
+        current[j] = 0;
+        continue;
+      }
+      left = within(i, j);
+      current[j] = left ? 1 : 0;
+      if (left) {
+        next_first = std::min(next_first, j);
+        next_last = j;
+      }
+    }
+    if (next_first == columns) {
+      return false;
+    }
+    std::fill(previous.begin() + static_cast<std::ptrdiff_t>(first),
+              previous.begin() + static_cast<std::ptrdiff_t>(last) + 1, 0);
+    std::swap(previous, current);
+    first = next_first;
+    last = next_last;
+  }
+  return last == columns - 1;
+}
+
+}  // namespace geometry
@@ -0,0 +1,233 @@
+/**
+ * @file geometry/polyline_resample.cpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Resampling and interpolation of Point2D sequences by arc length
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/polyline_resample.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+#include "detail/arc_length.hpp"
+#include "detail/parallel.hpp"
+
+namespace {
+using geometry::detail::AddLength;
+using geometry::detail::CheckFinite;
+using geometry::detail::SegmentLength;
+
+constexpr std::size_t kPolylineGrain{16};
+
+auto CheckSpacing(const geometry::Distance& spacing) -> int64_t {
+  if (spacing.GetNanometer() <= 0) {
+    throw std::invalid_argument("Invalid input: Spacing not positive");
+  }
+  return spacing.GetNanometer();
+}
+
+auto TotalLength(const geometry::Point2D* points, std::size_t count)
+    -> int64_t {
+  CheckFinite(points[0]);
+  int64_t total{0};
+  for (std::size_t i = 0; i + 1 < count; ++i) {
+    total = AddLength(total, SegmentLength(points[i], points[i + 1]));
+  }
+  return total;
+}
+
+/**
+ * @brief Position at fraction t of the segment from points[segment].
+ */
+auto Evaluate(const geometry::Point2D* points, std::size_t count,
+              std::size_t segment, double t,
+              geometry::Interpolation interpolation) -> geometry::Point2D {
+  const double x1{points[segment].GetX()};
+  const double y1{points[segment].GetY()};
+  const double x2{points[segment + 1].GetX()};
+  const double y2{points[segment + 1].GetY()};
+  if (interpolation == geometry::Interpolation::kLinear) {
+    // Exact at both ends.
+    return {((1.0 - t) * x1) + (t * x2), ((1.0 - t) * y1) + (t * y2)};
+  }
+  // Missing neighbours at the ends are mirrored through the end point.
+  double x0{(2.0 * x1) - x2};
+  double y0{(2.0 * y1) - y2};
+  if (segment > 0) {
+    x0 = points[segment - 1].GetX();
+    y0 = points[segment - 1].GetY();
+  }
+  double x3{(2.0 * x2) - x1};
+  double y3{(2.0 * y2) - y1};
+  if (segment + 2 < count) {
+    x3 = points[segment + 2].GetX();
+    y3 = points[segment + 2].GetY();
+  }
+  const double t2{t * t};
+  const double t3{t2 * t};
+  auto spline{[&](double p0, double p1, double p2, double p3) {
+    return 0.5 * ((2.0 * p1) + ((p2 - p0) * t) +
+                  (((2.0 * p0) - (5.0 * p1) + (4.0 * p2) - p3) * t2) +
+                  (((3.0 * (p1 - p2)) + p3 - p0) * t3));
+  }};
+  return {spline(x0, x1, x2, x3), spline(y0, y1, y2, y3)};
+}
+
+auto Resample(const geometry::Point2D* points, std::size_t count,
+              int64_t spacing, geometry::Interpolation interpolation,
+              geometry::Point2D* samples) -> std::size_t {
+  if (count == 0) {
+    return 0;
+  }
+  CheckFinite(points[0]);
+  samples[0] = points[0];
+  std::size_t written{1};
+  // Sample k sits at arc length k * spacing, which never overflows as it is
+  // at most the end of the current segment.
+  int64_t next{1};
+  int64_t start{0};
+  for (std::size_t segment = 0; segment + 1 < count; ++segment) {
+    const int64_t length{
+        SegmentLength(points[segment], points[segment + 1])};
+    const int64_t end{AddLength(start, length)};
+    const int64_t last{end / spacing};
+    if (next <= last) {
+      const double inverse{1.0 / static_cast<double>(length)};
+      for (; next <= last; ++next) {
+        const double t{static_cast<double>((next * spacing) - start) *
+                       inverse};
+        samples[written++] =
+            Evaluate(points, count, segment, t, interpolation);
+      }
+    }
+    start = end;
+  }
+  return written;
+}
+}  // namespace
+
+namespace geometry {
+
+auto GetResampleCount(const Point2D* points, std::size_t count,
+                      const Distance& spacing) -> std::size_t {
+  const int64_t step{CheckSpacing(spacing)};
+  if (count == 0) {
+    return 0;
+  }
+  return static_cast<std::size_t>(TotalLength(points, count) / step) + 1;
+}
+
+auto ResamplePolyline(const Point2D* points, std::size_t count,
+                      const Distance& spacing, Interpolation interpolation,
+                      Point2D* samples) -> std::size_t {
+  return Resample(points, count, CheckSpacing(spacing), interpolation,
+                  samples);
+}
+
+auto ResamplePolyline(const std::vector<Point2D>& points,
+                      const Distance& spacing, Interpolation interpolation)
+    -> std::vector<Point2D> {
+  std::vector<Point2D> samples(
+      GetResampleCount(points.data(), points.size(), spacing));
+  ResamplePolyline(points.data(), points.size(), spacing, interpolation,
+                   samples.data());
+  return samples;
+}
+
+auto ResamplePolylines(const std::vector<std::vector<Point2D>>& polylines,
+                       const Distance& spacing, Interpolation interpolation,
+                       std::size_t thread_count) -> ResampledPolylines {
+  const int64_t step{CheckSpacing(spacing)};
+  ResampledPolylines result;
+  result.offsets.assign(polylines.size() + 1, 0);
+  detail::ParallelFor(
+      polylines.size(), kPolylineGrain, thread_count,
+      [&](std::size_t begin, std::size_t end, std::size_t) {
+        for (std::size_t i = begin; i < end; ++i) {
+          result.offsets[i + 1] =
+              GetResampleCount(polylines[i].data(), polylines[i].size(),
+                               spacing);
+        }
+      });
+  for (std::size_t i = 0; i < polylines.size(); ++i) {
+    result.offsets[i + 1] += result.offsets[i];
+  }
+  result.points.resize(result.offsets.back());
+  detail::ParallelFor(
+      polylines.size(), kPolylineGrain, thread_count,
+      [&](std::size_t begin, std::size_t end, std::size_t) {
+        for (std::size_t i = begin; i < end; ++i) {
+          Resample(polylines[i].data(), polylines[i].size(), step,
+                   interpolation, result.points.data() + result.offsets[i]);
+        }
+      });
+  return result;
+}
+
+auto InterpolateAtArcLengths(const Point2D* points, std::size_t count,
+                             const Distance* arc_lengths,
+                             std::size_t arc_length_count,
+                             Interpolation interpolation, Point2D* positions)
+    -> void {
+  if (count == 0) {
+    throw std::invalid_argument("Invalid input: Empty sequence");
+  }
+  CheckFinite(points[0]);
+  // Arc length at the end of every segment.
+  std::vector<int64_t> ends(count - 1);
+  int64_t start{0};
+  for (std::size_t segment = 0; segment + 1 < count; ++segment) {
+    start = AddLength(start, SegmentLength(points[segment],
+                                           points[segment + 1]));
+    ends[segment] = start;
+  }
+  const int64_t total{ends.empty() ? 0 : ends.back()};
+  std::size_t hint{0};
+  int64_t previous{0};
+  for (std::size_t i = 0; i < arc_length_count; ++i) {
+    const int64_t arc_length{arc_lengths[i].GetNanometer()};
+    if (arc_length <= 0) {
+      positions[i] = points[0];
+      continue;
+    }
+    if (arc_length >= total) {
+      positions[i] = points[count - 1];
+      continue;
+    }
+    // Ascending arc lengths only search the segments after the last one.
+    if (arc_length < previous) {
+      hint = 0;
+    }
+    previous = arc_length;
+    // The first segment ending at or after the arc length, which is never
+    // of zero length as it ends beyond the one before.
+    const auto found{std::lower_bound(
+        ends.begin() + static_cast<std::ptrdiff_t>(hint), ends.end(),
+        arc_length)};
+    hint = static_cast<std::size_t>(found - ends.begin());
+    const int64_t segment_start{hint == 0 ? 0 : ends[hint - 1]};
+    const double t{static_cast<double>(arc_length - segment_start) /
+                   static_cast<double>(ends[hint] - segment_start)};
+    positions[i] = Evaluate(points, count, hint, t, interpolation);
+  }
+}
+
+auto InterpolateAtArcLengths(const std::vector<Point2D>& points,
+                             const std::vector<Distance>& arc_lengths,
+                             Interpolation interpolation)
+    -> std::vector<Point2D> {
+  std::vector<Point2D> positions(arc_lengths.size());
+  InterpolateAtArcLengths(points.data(), points.size(), arc_lengths.data(),
+                          arc_lengths.size(), interpolation,
+                          positions.data());
+  return positions;
+}
+
+}  // namespace geometry
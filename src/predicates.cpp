@@ -0,0 +1,623 @@
+/**
+ * @file geometry/predicates.cpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Robust orientation and in-circle predicates with adaptive precision
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/predicates.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "detail/kernel_dispatch.hpp"
+
+// The error-free transformations below rely on every operation being rounded
+// on its own, which holds as long as the compiler does not contract a * b + c
+// into a fused multiply-add. GCC and Clang do so by default in C++ whenever
+// the target has FMA, as the AVX2 and AVX-512 kernel variants do, so the
+// library is built with -ffp-contract=off; the pragma keeps Clang from
+// contracting even when the file is built without it.
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#endif
+
+namespace {
+constexpr double kEpsilon{0x1p-53};  // Half an ulp of 1
+constexpr double kSplitter{134217729.0};  // 2^27 + 1
+constexpr double kResultErrorBound{(3.0 + 8.0 * kEpsilon) * kEpsilon};
+constexpr double kOrientErrorBoundA{(3.0 + 16.0 * kEpsilon) * kEpsilon};
+constexpr double kOrientErrorBoundB{(2.0 + 12.0 * kEpsilon) * kEpsilon};
+constexpr double kOrientErrorBoundC{(9.0 + 64.0 * kEpsilon) * kEpsilon *
+                                    kEpsilon};
+constexpr double kCircleErrorBoundA{(10.0 + 96.0 * kEpsilon) * kEpsilon};
+constexpr double kCircleErrorBoundB{(4.0 + 48.0 * kEpsilon) * kEpsilon};
+constexpr double kCircleErrorBoundC{(44.0 + 576.0 * kEpsilon) * kEpsilon *
+                                    kEpsilon};
+constexpr std::size_t kBlockSize{256};
+
+// Expansion buffers below are left uninitialized on purpose: zeroing them
+// costs more than the arithmetic, and only the returned sizes are read.
+
+// Error-free transformations: x is the rounded result and y its exact error.
+
+inline auto FastTwoSum(double a, double b, double& x, double& y) -> void {
+  x = a + b;
+  y = b - (x - a);
+}
+
+inline auto TwoSum(double a, double b, double& x, double& y) -> void {
+  x = a + b;
+  const double b_virtual{x - a};
+  const double a_virtual{x - b_virtual};
+  y = (a - a_virtual) + (b - b_virtual);
+}
+
+inline auto TwoDiffTail(double a, double b, double x) -> double {
+  const double b_virtual{a - x};
+  const double a_virtual{x + b_virtual};
+  return (a - a_virtual) + (b_virtual - b);
+}
+
+inline auto TwoDiff(double a, double b, double& x, double& y) -> void {
+  x = a - b;
+  y = TwoDiffTail(a, b, x);
+}
+
+inline auto Split(double a, double& high, double& low) -> void {
+  const double c{kSplitter * a};
+  high = c - (c - a);
+  low = a - high;
+}
+
+inline auto TwoProductPresplit(double a, double b, double b_high, double b_low,
+                               double& x, double& y) -> void {
+  x = a * b;
+  double a_high;
+  double a_low;
+  Split(a, a_high, a_low);
+  const double error{((x - (a_high * b_high)) - (a_low * b_high)) -
+                     (a_high * b_low)};
+  y = (a_low * b_low) - error;
+}
+
+inline auto TwoProduct(double a, double b, double& x, double& y) -> void {
+  double b_high;
+  double b_low;
+  Split(b, b_high, b_low);
+  TwoProductPresplit(a, b, b_high, b_low, x, y);
+}
+
+/**
+ * @brief Exact (a1 + a0) - (b1 + b0) as four components, smallest first.
+ */
+inline auto TwoTwoDiff(double a1, double a0, double b1, double b0,
+                       double* x) -> void {
+  double i;
+  double j;
+  double k;
+  TwoDiff(a0, b0, i, x[0]);
+  TwoSum(a1, i, j, k);
+  TwoDiff(k, b1, i, x[1]);
+  TwoSum(j, i, x[3], x[2]);
+}
+
+/**
+ * @brief Sum of two nonoverlapping expansions, merged by magnitude, with zero
+ * components eliminated.
+ * @return std::size_t The number of components of h, at least 1.
+ */
+auto ExpansionSum(std::size_t e_size, const double* e, std::size_t f_size,
+                  const double* f, double* h) -> std::size_t {
+  std::size_t e_index{0};
+  std::size_t f_index{0};
+  std::size_t h_index{0};
+  double e_now{e[0]};
+  double f_now{f[0]};
+  double q;
+  if ((f_now > e_now) == (f_now > -e_now)) {
+    q = e_now;
+    e_now = (++e_index < e_size) ? e[e_index] : 0.0;
+  } else {
+    q = f_now;
+    f_now = (++f_index < f_size) ? f[f_index] : 0.0;
+  }
+  double sum;
+  double error;
+  while (e_index < e_size && f_index < f_size) {
+    if ((f_now > e_now) == (f_now > -e_now)) {
+      TwoSum(q, e_now, sum, error);
+      e_now = (++e_index < e_size) ? e[e_index] : 0.0;
+    } else {
+      TwoSum(q, f_now, sum, error);
+      f_now = (++f_index < f_size) ? f[f_index] : 0.0;
+    }
+    q = sum;
+    if (error != 0.0) {
+      h[h_index++] = error;
+    }
+  }
+  for (; e_index < e_size; ++e_index) {
+    TwoSum(q, e[e_index], sum, error);
+    q = sum;
+    if (error != 0.0) {
+      h[h_index++] = error;
+    }
+  }
+  for (; f_index < f_size; ++f_index) {
+    TwoSum(q, f[f_index], sum, error);
+    q = sum;
+    if (error != 0.0) {
+      h[h_index++] = error;
+    }
+  }
+  if (q != 0.0 || h_index == 0) {
+    h[h_index++] = q;
+  }
+  return h_index;
+}
+
+/**
+ * @brief Product of a nonoverlapping expansion and a double, with zero
+ * components eliminated.
+ * @return std::size_t The number of components of h, at least 1.
+ */
+auto ScaleExpansion(std::size_t e_size, const double* e, double b, double* h)
+    -> std::size_t {
+  double b_high;
+  double b_low;
+  Split(b, b_high, b_low);
+  std::size_t h_index{0};
+  double q;
+  double error;
+  TwoProductPresplit(e[0], b, b_high, b_low, q, error);
+  if (error != 0.0) {
+    h[h_index++] = error;
+  }
+  for (std::size_t i = 1; i < e_size; ++i) {
+    double product_high;
+    double product_low;
+    double sum;
+    TwoProductPresplit(e[i], b, b_high, b_low, product_high, product_low);
+    TwoSum(q, product_low, sum, error);
+    if (error != 0.0) {
+      h[h_index++] = error;
+    }
+    FastTwoSum(product_high, sum, q, error);
+    if (error != 0.0) {
+      h[h_index++] = error;
+    }
+  }
+  if (q != 0.0 || h_index == 0) {
+    h[h_index++] = q;
+  }
+  return h_index;
+}
+
+auto Estimate(std::size_t size, const double* e) -> double {
+  double sum{0.0};
+  for (std::size_t i = 0; i < size; ++i) {
+    sum += e[i];
+  }
+  return sum;
+}
+
+/**
+ * @brief Growable expansion for the exact fallback, which is rare enough to
+ * allocate.
+ */
+using Expansion = std::vector<double>;
+
+auto Add(const Expansion& e, const Expansion& f) -> Expansion {
+  Expansion h(e.size() + f.size());
+  h.resize(ExpansionSum(e.size(), e.data(), f.size(), f.data(), h.data()));
+  return h;
+}
+
+auto Multiply(const Expansion& e, const Expansion& f) -> Expansion {
+  Expansion product{0.0};
+  Expansion scaled(2 * e.size());
+  for (const double term : f) {
+    scaled.resize(2 * e.size());
+    scaled.resize(ScaleExpansion(e.size(), e.data(), term, scaled.data()));
+    product = Add(product, scaled);
+  }
+  return product;
+}
+
+auto Negate(Expansion e) -> Expansion {
+  for (double& term : e) {
+    term = -term;
+  }
+  return e;
+}
+
+/**
+ * @brief Exact difference a - b as an expansion.
+ */
+auto Difference(double a, double b) -> Expansion {
+  double x;
+  double y;
+  TwoDiff(a, b, x, y);
+  return {y, x};
+}
+
+/**
+ * @brief Refine an orientation the filter could not settle, stages B to D of
+ * Shewchuk's orient2dadapt.
+ */
+auto OrientAdapt(double a_x, double a_y, double b_x, double b_y, double c_x,
+                 double c_y, double det_sum) -> double {
+  const double ac_x{a_x - c_x};
+  const double bc_x{b_x - c_x};
+  const double ac_y{a_y - c_y};
+  const double bc_y{b_y - c_y};
+
+  double left;
+  double left_tail;
+  double right;
+  double right_tail;
+  TwoProduct(ac_x, bc_y, left, left_tail);
+  TwoProduct(ac_y, bc_x, right, right_tail);
+  std::array<double, 4> b;
+  TwoTwoDiff(left, left_tail, right, right_tail, b.data());
+  double det{Estimate(b.size(), b.data())};
+  double error_bound{kOrientErrorBoundB * det_sum};
+  if (det >= error_bound || -det >= error_bound) {
+    return det;
+  }
+
+  const double ac_x_tail{TwoDiffTail(a_x, c_x, ac_x)};
+  const double bc_x_tail{TwoDiffTail(b_x, c_x, bc_x)};
+  const double ac_y_tail{TwoDiffTail(a_y, c_y, ac_y)};
+  const double bc_y_tail{TwoDiffTail(b_y, c_y, bc_y)};
+  if (ac_x_tail == 0.0 && ac_y_tail == 0.0 && bc_x_tail == 0.0 &&
+      bc_y_tail == 0.0) {
+    return det;
+  }
+  error_bound =
+      (kOrientErrorBoundC * det_sum) + (kResultErrorBound * std::abs(det));
+  det += ((ac_x * bc_y_tail) + (bc_y * ac_x_tail)) -
+         ((ac_y * bc_x_tail) + (bc_x * ac_y_tail));
+  if (det >= error_bound || -det >= error_bound) {
+    return det;
+  }
+
+  std::array<double, 4> u;
+  std::array<double, 8> c1;
+  std::array<double, 12> c2;
+  std::array<double, 16> d;
+  TwoProduct(ac_x_tail, bc_y, left, left_tail);
+  TwoProduct(ac_y_tail, bc_x, right, right_tail);
+  TwoTwoDiff(left, left_tail, right, right_tail, u.data());
+  const std::size_t c1_size{
+      ExpansionSum(b.size(), b.data(), u.size(), u.data(), c1.data())};
+  TwoProduct(ac_x, bc_y_tail, left, left_tail);
+  TwoProduct(ac_y, bc_x_tail, right, right_tail);
+  TwoTwoDiff(left, left_tail, right, right_tail, u.data());
+  const std::size_t c2_size{
+      ExpansionSum(c1_size, c1.data(), u.size(), u.data(), c2.data())};
+  TwoProduct(ac_x_tail, bc_y_tail, left, left_tail);
+  TwoProduct(ac_y_tail, bc_x_tail, right, right_tail);
+  TwoTwoDiff(left, left_tail, right, right_tail, u.data());
+  const std::size_t d_size{
+      ExpansionSum(c2_size, c2.data(), u.size(), u.data(), d.data())};
+  return d[d_size - 1];
+}
+
+/**
+ * @brief Orientation with the stage A filter, Shewchuk's orient2d.
+ */
+inline auto Orient(double a_x, double a_y, double b_x, double b_y, double c_x,
+                   double c_y) -> double {
+  const double left{(a_x - c_x) * (b_y - c_y)};
+  const double right{(a_y - c_y) * (b_x - c_x)};
+  const double det{left - right};
+  const double det_sum{std::abs(left) + std::abs(right)};
+  const double error_bound{kOrientErrorBoundA * det_sum};
+  if (det >= error_bound || -det >= error_bound) {
+    return det;
+  }
+  return OrientAdapt(a_x, a_y, b_x, b_y, c_x, c_y, det_sum);
+}
+
+/**
+ * @brief Lifted cofactor of one circle point: the 2x2 minor of the other two
+ * times the squared length of the point, as expansions of the differences
+ * rounded to doubles.
+ * @return std::size_t The number of components of h, at most 32.
+ */
+auto LiftedMinor(double x, double y, double p_x, double p_y, double q_x,
+                 double q_y, double* h) -> std::size_t {
+  double left;
+  double left_tail;
+  double right;
+  double right_tail;
+  TwoProduct(p_x, q_y, left, left_tail);
+  TwoProduct(q_x, p_y, right, right_tail);
+  std::array<double, 4> minor;
+  TwoTwoDiff(left, left_tail, right, right_tail, minor.data());
+  std::array<double, 8> x_minor;
+  std::array<double, 16> xx_minor;
+  std::array<double, 8> y_minor;
+  std::array<double, 16> yy_minor;
+  const std::size_t x_size{
+      ScaleExpansion(minor.size(), minor.data(), x, x_minor.data())};
+  const std::size_t xx_size{
+      ScaleExpansion(x_size, x_minor.data(), x, xx_minor.data())};
+  const std::size_t y_size{
+      ScaleExpansion(minor.size(), minor.data(), y, y_minor.data())};
+  const std::size_t yy_size{
+      ScaleExpansion(y_size, y_minor.data(), y, yy_minor.data())};
+  return ExpansionSum(xx_size, xx_minor.data(), yy_size, yy_minor.data(), h);
+}
+
+/**
+ * @brief Exact in-circle determinant from the exact coordinate differences,
+ * in place of the final stage of Shewchuk's incircleadapt.
+ */
+auto CircleExact(double a_x, double a_y, double b_x, double b_y, double c_x,
+                 double c_y, double d_x, double d_y) -> double {
+  const Expansion ad_x{Difference(a_x, d_x)};
+  const Expansion ad_y{Difference(a_y, d_y)};
+  const Expansion bd_x{Difference(b_x, d_x)};
+  const Expansion bd_y{Difference(b_y, d_y)};
+  const Expansion cd_x{Difference(c_x, d_x)};
+  const Expansion cd_y{Difference(c_y, d_y)};
+  auto cross{[](const Expansion& p_x, const Expansion& p_y,
+                const Expansion& q_x, const Expansion& q_y) {
+    return Add(Multiply(p_x, q_y), Negate(Multiply(q_x, p_y)));
+  }};
+  auto lift{[](const Expansion& x, const Expansion& y) {
+    return Add(Multiply(x, x), Multiply(y, y));
+  }};
+  const Expansion det{
+      Add(Add(Multiply(lift(ad_x, ad_y), cross(bd_x, bd_y, cd_x, cd_y)),
+              Multiply(lift(bd_x, bd_y), cross(cd_x, cd_y, ad_x, ad_y))),
+          Multiply(lift(cd_x, cd_y), cross(ad_x, ad_y, bd_x, bd_y)))};
+  return det.back();
+}
+
+/**
+ * @brief Refine an in-circle test the filter could not settle, stages B and
+ * C of Shewchuk's incircleadapt followed by an exact evaluation.
+ */
+auto CircleAdapt(double a_x, double a_y, double b_x, double b_y, double c_x,
+                 double c_y, double d_x, double d_y, double permanent)
+    -> double {
+  const double ad_x{a_x - d_x};
+  const double bd_x{b_x - d_x};
+  const double cd_x{c_x - d_x};
+  const double ad_y{a_y - d_y};
+  const double bd_y{b_y - d_y};
+  const double cd_y{c_y - d_y};
+
+  std::array<double, 32> a_det;
+  std::array<double, 32> b_det;
+  std::array<double, 32> c_det;
+  std::array<double, 64> ab_det;
+  std::array<double, 96> det_expansion;
+  const std::size_t a_size{
+      LiftedMinor(ad_x, ad_y, bd_x, bd_y, cd_x, cd_y, a_det.data())};
+  const std::size_t b_size{
+      LiftedMinor(bd_x, bd_y, cd_x, cd_y, ad_x, ad_y, b_det.data())};
+  const std::size_t c_size{
+      LiftedMinor(cd_x, cd_y, ad_x, ad_y, bd_x, bd_y, c_det.data())};
+  const std::size_t ab_size{ExpansionSum(a_size, a_det.data(), b_size,
+                                         b_det.data(), ab_det.data())};
+  const std::size_t det_size{ExpansionSum(ab_size, ab_det.data(), c_size,
+                                          c_det.data(),
+                                          det_expansion.data())};
+  double det{Estimate(det_size, det_expansion.data())};
+  double error_bound{kCircleErrorBoundB * permanent};
+  if (det >= error_bound || -det >= error_bound) {
+    return det;
+  }
+
+  const double ad_x_tail{TwoDiffTail(a_x, d_x, ad_x)};
+  const double ad_y_tail{TwoDiffTail(a_y, d_y, ad_y)};
+  const double bd_x_tail{TwoDiffTail(b_x, d_x, bd_x)};
+  const double bd_y_tail{TwoDiffTail(b_y, d_y, bd_y)};
+  const double cd_x_tail{TwoDiffTail(c_x, d_x, cd_x)};
+  const double cd_y_tail{TwoDiffTail(c_y, d_y, cd_y)};
+  if (ad_x_tail == 0.0 && bd_x_tail == 0.0 && cd_x_tail == 0.0 &&
+      ad_y_tail == 0.0 && bd_y_tail == 0.0 && cd_y_tail == 0.0) {
+    return det;
+  }
+  error_bound =
+      (kCircleErrorBoundC * permanent) + (kResultErrorBound * std::abs(det));
+  det += ((((ad_x * ad_x) + (ad_y * ad_y)) *
+           (((bd_x * cd_y_tail) + (cd_y * bd_x_tail)) -
+            ((bd_y * cd_x_tail) + (cd_x * bd_y_tail)))) +
+          (2.0 * ((ad_x * ad_x_tail) + (ad_y * ad_y_tail)) *
+           ((bd_x * cd_y) - (bd_y * cd_x)))) +
+         ((((bd_x * bd_x) + (bd_y * bd_y)) *
+           (((cd_x * ad_y_tail) + (ad_y * cd_x_tail)) -
+            ((cd_y * ad_x_tail) + (ad_x * cd_y_tail)))) +
+          (2.0 * ((bd_x * bd_x_tail) + (bd_y * bd_y_tail)) *
+           ((cd_x * ad_y) - (cd_y * ad_x)))) +
+         ((((cd_x * cd_x) + (cd_y * cd_y)) *
+           (((ad_x * bd_y_tail) + (bd_y * ad_x_tail)) -
+            ((ad_y * bd_x_tail) + (bd_x * ad_y_tail)))) +
+          (2.0 * ((cd_x * cd_x_tail) + (cd_y * cd_y_tail)) *
+           ((ad_x * bd_y) - (ad_y * bd_x))));
+  if (det >= error_bound || -det >= error_bound) {
+    return det;
+  }
+  return CircleExact(a_x, a_y, b_x, b_y, c_x, c_y, d_x, d_y);
+}
+
+/**
+ * @brief In-circle determinant and its permanent, the stage A filter of
+ * Shewchuk's incircle.
+ */
+inline auto CircleFilter(double a_x, double a_y, double b_x, double b_y,
+                         double c_x, double c_y, double d_x, double d_y,
+                         double& permanent) -> double {
+  const double ad_x{a_x - d_x};
+  const double bd_x{b_x - d_x};
+  const double cd_x{c_x - d_x};
+  const double ad_y{a_y - d_y};
+  const double bd_y{b_y - d_y};
+  const double cd_y{c_y - d_y};
+  const double bd_x_cd_y{bd_x * cd_y};
+  const double cd_x_bd_y{cd_x * bd_y};
+  const double a_lift{(ad_x * ad_x) + (ad_y * ad_y)};
+  const double cd_x_ad_y{cd_x * ad_y};
+  const double ad_x_cd_y{ad_x * cd_y};
+  const double b_lift{(bd_x * bd_x) + (bd_y * bd_y)};
+  const double ad_x_bd_y{ad_x * bd_y};
+  const double bd_x_ad_y{bd_x * ad_y};
+  const double c_lift{(cd_x * cd_x) + (cd_y * cd_y)};
+  permanent =
+      ((std::abs(bd_x_cd_y) + std::abs(cd_x_bd_y)) * a_lift) +
+      ((std::abs(cd_x_ad_y) + std::abs(ad_x_cd_y)) * b_lift) +
+      ((std::abs(ad_x_bd_y) + std::abs(bd_x_ad_y)) * c_lift);
+  return (a_lift * (bd_x_cd_y - cd_x_bd_y)) +
+         (b_lift * (cd_x_ad_y - ad_x_cd_y)) +
+         (c_lift * (ad_x_bd_y - bd_x_ad_y));
+}
+
+/**
+ * @brief Batch orientation filter, compiled once per kernel path.
+ */
+GEOMETRY_ALWAYS_INLINE auto OrientFilterBody(double a_x, double a_y,
+                                             double b_x, double b_y,
+                                             const double* xs,
+                                             const double* ys,
+                                             std::size_t count, double* dets,
+                                             double* sums) -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    const double left{(a_x - xs[i]) * (b_y - ys[i])};
+    const double right{(a_y - ys[i]) * (b_x - xs[i])};
+    dets[i] = left - right;
+    sums[i] = std::abs(left) + std::abs(right);
+  }
+}
+
+/**
+ * @brief Batch in-circle filter, compiled once per kernel path.
+ */
+GEOMETRY_ALWAYS_INLINE auto CircleFilterBody(double a_x, double a_y,
+                                             double b_x, double b_y,
+                                             double c_x, double c_y,
+                                             const double* xs,
+                                             const double* ys,
+                                             std::size_t count, double* dets,
+                                             double* permanents) -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    dets[i] = CircleFilter(a_x, a_y, b_x, b_y, c_x, c_y, xs[i], ys[i],
+                           permanents[i]);
+  }
+}
+}  // namespace
+
+namespace geometry {
+
+auto Orient2D(double a_x, double a_y, double b_x, double b_y, double c_x,
+              double c_y) -> double {
+  return Orient(a_x, a_y, b_x, b_y, c_x, c_y);
+}
+
+auto Orient2D(const Point2D& a, const Point2D& b, const Point2D& c)
+    -> double {
+  return Orient(a.GetX(), a.GetY(), b.GetX(), b.GetY(), c.GetX(), c.GetY());
+}
+
+auto Orient2D(const Point2D& a, const Point2D& b, const Point2D* points,
+              std::size_t count, double* results) -> void {
+  const double a_x{a.GetX()};
+  const double a_y{a.GetY()};
+  const double b_x{b.GetX()};
+  const double b_y{b.GetY()};
+  const auto filter{detail::DispatchKernel<&OrientFilterBody>()};
+  std::array<double, kBlockSize> xs{};
+  std::array<double, kBlockSize> ys{};
+  std::array<double, kBlockSize> sums{};
+  for (std::size_t first = 0; first < count; first += kBlockSize) {
+    const std::size_t size{std::min(kBlockSize, count - first)};
+    double* block{results + first};
+    for (std::size_t i = 0; i < size; ++i) {
+      xs[i] = points[first + i].GetX();
+      ys[i] = points[first + i].GetY();
+    }
+    filter(a_x, a_y, b_x, b_y, xs.data(), ys.data(), size, block,
+           sums.data());
+    for (std::size_t i = 0; i < size; ++i) {
+      if (std::abs(block[i]) < kOrientErrorBoundA * sums[i]) {
+        block[i] = OrientAdapt(a_x, a_y, b_x, b_y, xs[i], ys[i], sums[i]);
+      }
+    }
+  }
+}
+
+auto Orient2D(const Point2D& a, const Point2D& b,
+              const std::vector<Point2D>& points) -> std::vector<double> {
+  std::vector<double> results(points.size());
+  Orient2D(a, b, points.data(), points.size(), results.data());
+  return results;
+}
+
+auto InCircle(double a_x, double a_y, double b_x, double b_y, double c_x,
+              double c_y, double d_x, double d_y) -> double {
+  double permanent;
+  const double det{
+      CircleFilter(a_x, a_y, b_x, b_y, c_x, c_y, d_x, d_y, permanent)};
+  const double error_bound{kCircleErrorBoundA * permanent};
+  if (det > error_bound || -det > error_bound) {
+    return det;
+  }
+  return CircleAdapt(a_x, a_y, b_x, b_y, c_x, c_y, d_x, d_y, permanent);
+}
+
+auto InCircle(const Point2D& a, const Point2D& b, const Point2D& c,
+              const Point2D& d) -> double {
+  return InCircle(a.GetX(), a.GetY(), b.GetX(), b.GetY(), c.GetX(), c.GetY(),
+                  d.GetX(), d.GetY());
+}
+
+auto InCircle(const Point2D& a, const Point2D& b, const Point2D& c,
+              const Point2D* points, std::size_t count, double* results)
+    -> void {
+  const double a_x{a.GetX()};
+  const double a_y{a.GetY()};
+  const double b_x{b.GetX()};
+  const double b_y{b.GetY()};
+  const double c_x{c.GetX()};
+  const double c_y{c.GetY()};
+  const auto filter{detail::DispatchKernel<&CircleFilterBody>()};
+  std::array<double, kBlockSize> xs{};
+  std::array<double, kBlockSize> ys{};
+  std::array<double, kBlockSize> permanents{};
+  for (std::size_t first = 0; first < count; first += kBlockSize) {
+    const std::size_t size{std::min(kBlockSize, count - first)};
+    double* block{results + first};
+    for (std::size_t i = 0; i < size; ++i) {
+      xs[i] = points[first + i].GetX();
+      ys[i] = points[first + i].GetY();
+    }
+    filter(a_x, a_y, b_x, b_y, c_x, c_y, xs.data(), ys.data(), size, block,
+           permanents.data());
+    for (std::size_t i = 0; i < size; ++i) {
+      if (std::abs(block[i]) <= kCircleErrorBoundA * permanents[i]) {
+        block[i] = CircleAdapt(a_x, a_y, b_x, b_y, c_x, c_y, xs[i], ys[i],
+                               permanents[i]);
+      }
+    }
+  }
+}
+
+auto InCircle(const Point2D& a, const Point2D& b, const Point2D& c,
+              const std::vector<Point2D>& points) -> std::vector<double> {
+  std::vector<double> results(points.size());
+  InCircle(a, b, c, points.data(), points.size(), results.data());
+  return results;
+}
+
+}  // namespace geometry
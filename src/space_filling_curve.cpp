@@ -0,0 +1,276 @@
+/**
+ * @file geometry/space_filling_curve.cpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Morton and Hilbert curve keys and curve ordering of point arrays
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/space_filling_curve.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <numeric>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include "detail/kernel_dispatch.hpp"
+#include "detail/parallel.hpp"
+#include "detail/radix_sort.hpp"
+#include "geometry/accumulators.hpp"
+
+namespace {
+constexpr uint64_t kLowMask{0xFFFFFFFFULL};
+constexpr double kMaxCell{4294967295.0};
+constexpr std::size_t kKeyGrain{std::size_t{1} << 14};
+constexpr std::size_t kBlockSize{256};
+
+/**
+ * @brief Move the 32 low bits of value to the even bits.
+ */
+inline auto Spread(uint64_t value) -> uint64_t {
+  value &= kLowMask;
+  value = (value | (value << 16U)) & 0x0000FFFF0000FFFFULL;
+  value = (value | (value << 8U)) & 0x00FF00FF00FF00FFULL;
+  value = (value | (value << 4U)) & 0x0F0F0F0F0F0F0F0FULL;
+  value = (value | (value << 2U)) & 0x3333333333333333ULL;
+  value = (value | (value << 1U)) & 0x5555555555555555ULL;
+  return value;
+}
+
+#if defined(GEOMETRY_X86_KERNELS)
+/**
+ * @brief Morton key by parallel bit deposit, for the kernel paths that imply
+ * BMI2. Inlined into their variants, never called on the baseline path.
+ */
+__attribute__((target("bmi2"))) inline auto DepositMortonKey(uint32_t x,
+                                                             uint32_t y)
+    -> uint64_t {
+  return _pdep_u64(x, 0x5555555555555555ULL) |
+         _pdep_u64(y, 0xAAAAAAAAAAAAAAAAULL);
+}
+#endif
+
+/**
+ * @brief Morton key of a cell, by parallel bit deposit if kDeposit.
+ */
+template <bool kDeposit>
+GEOMETRY_ALWAYS_INLINE auto MortonKey(uint32_t x, uint32_t y) -> uint64_t {
+#if defined(GEOMETRY_X86_KERNELS)
+  if constexpr (kDeposit) {
+    return DepositMortonKey(x, y);
+  }
+#endif
+  return Spread(x) | (Spread(y) << 1U);
+}
+
+/**
+ * @brief Affine map of a bounding box onto the 2^32 by 2^32 cell grid.
+ */
+class CellGrid {
+ public:
+  CellGrid(const geometry::Point2D& min_corner,
+           const geometry::Point2D& max_corner)
+      : min_x_(min_corner.GetX()),
+        min_y_(min_corner.GetY()),
+        scale_x_(Scale(max_corner.GetX() - min_x_)),
+        scale_y_(Scale(max_corner.GetY() - min_y_)) {}
+
+  [[nodiscard]] auto Column(double x) const -> uint32_t {
+    return Cell((x - min_x_) * scale_x_);
+  }
+
+  [[nodiscard]] auto Row(double y) const -> uint32_t {
+    return Cell((y - min_y_) * scale_y_);
+  }
+
+ private:
+  static auto Scale(double extent) -> double {
+    return extent > 0.0 ? kMaxCell / extent : 0.0;
+  }
+
+  static auto Cell(double offset) -> uint32_t {
+    // Written so that NaN lands in cell 0.
+    return static_cast<uint32_t>(std::min(kMaxCell, std::max(0.0, offset)));
+  }
+
+  double min_x_;    ///< Lower x bound
+  double min_y_;    ///< Lower y bound
+  double scale_x_;  ///< Cells per unit x
+  double scale_y_;  ///< Cells per unit y
+};
+
+/**
+ * @brief Hilbert key of a cell, by a branch-free prefix scan over the curve
+ * states of all bit levels at once, after the scheme published by Fabian
+ * Giesen, widened to 32 bits per axis.
+ */
+inline auto HilbertKey(uint32_t x, uint32_t y) -> uint64_t {
+  const uint64_t column{x};
+  const uint64_t row{y};
+  uint64_t state_a;
+  uint64_t state_b;
+  uint64_t state_c;
+  uint64_t state_d;
+  {
+    const uint64_t a{column ^ row};
+    const uint64_t b{kLowMask ^ a};
+    const uint64_t c{kLowMask ^ (column | row)};
+    const uint64_t d{column & (row ^ kLowMask)};
+    state_a = a | (b >> 1U);
+    state_b = (a >> 1U) ^ a;
+    state_c = ((c >> 1U) ^ (b & (d >> 1U))) ^ c;
+    state_d = ((a & (c >> 1U)) ^ (d >> 1U)) ^ d;
+  }
+  for (const unsigned shift : {2U, 4U, 8U, 16U}) {
+    const uint64_t a{state_a};
+    const uint64_t b{state_b};
+    const uint64_t c{state_c};
+    const uint64_t d{state_d};
+    state_a = (a & (a >> shift)) ^ (b & (b >> shift));
+    state_b = (a & (b >> shift)) ^ (b & ((a ^ b) >> shift));
+    state_c ^= (a & (c >> shift)) ^ (b & (d >> shift));
+    state_d ^= (b & (c >> shift)) ^ ((a ^ b) & (d >> shift));
+  }
+  const uint64_t a{state_c ^ (state_c >> 1U)};
+  const uint64_t b{state_d ^ (state_d >> 1U)};
+  const uint64_t low{column ^ row};
+  const uint64_t high{b | (kLowMask ^ (low | a))};
+  return (Spread(high) << 1U) | Spread(low);
+}
+
+/**
+ * @brief Batch kernel body, compiled once per kernel path.
+ */
+template <geometry::SpaceFillingCurve kCurve, bool kDeposit = false>
+GEOMETRY_ALWAYS_INLINE auto CurveKeysBody(const double* xs, const double* ys,
+                                          std::size_t count,
+                                          const CellGrid* grid,
+                                          uint64_t* keys) -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    const uint32_t column{grid->Column(xs[i])};
+    const uint32_t row{grid->Row(ys[i])};
+    if constexpr (kCurve == geometry::SpaceFillingCurve::kMorton) {
+      keys[i] = MortonKey<kDeposit>(column, row);
+    } else {
+      keys[i] = HilbertKey(column, row);
+    }
+  }
+}
+
+/**
+ * @brief Single key kernel body behind EncodeMorton.
+ */
+template <bool kDeposit>
+GEOMETRY_ALWAYS_INLINE auto MortonBody(uint32_t x, uint32_t y, uint64_t* key)
+    -> void {
+  *key = MortonKey<kDeposit>(x, y);
+}
+
+/**
+ * @brief The variant of a Morton kernel body for the bound kernel path: the
+ * Avx2 and Avx512 variants of the bit deposit body, otherwise the baseline of
+ * the shift and mask body.
+ * @return The kernel function.
+ */
+template <auto kSpreadBody, auto kDepositBody>
+auto DispatchMortonKernel() -> decltype(kSpreadBody) {
+#if defined(GEOMETRY_X86_KERNELS)
+  switch (geometry::GetKernelPath()) {
+    case geometry::KernelPath::kAvx512:
+      return &geometry::detail::Kernel<kDepositBody>::Avx512;
+    case geometry::KernelPath::kAvx2:
+      return &geometry::detail::Kernel<kDepositBody>::Avx2;
+    default:
+      break;
+  }
+#endif
+  return geometry::detail::DispatchKernel<kSpreadBody>();
+}
+}  // namespace
+
+namespace geometry {
+
+auto EncodeMorton(uint32_t x, uint32_t y) -> uint64_t {
+  uint64_t key{0};
+  DispatchMortonKernel<&MortonBody<false>, &MortonBody<true>>()(x, y, &key);
+  return key;
+}
+
+auto EncodeHilbert(uint32_t x, uint32_t y) -> uint64_t {
+  return HilbertKey(x, y);
+}
+
+auto ComputeCurveKey(const Point2D& point, const Point2D& min_corner,
+                     const Point2D& max_corner, SpaceFillingCurve curve)
+    -> uint64_t {
+  uint64_t key{0};
+  ComputeCurveKeys(&point, 1, min_corner, max_corner, curve, &key);
+  return key;
+}
+
+auto ComputeCurveKeys(const Point2D* points, std::size_t count,
+                      const Point2D& min_corner, const Point2D& max_corner,
+                      SpaceFillingCurve curve, uint64_t* keys) -> void {
+  const CellGrid grid(min_corner, max_corner);
+  const auto kernel{
+      curve == SpaceFillingCurve::kMorton
+          ? DispatchMortonKernel<
+                &CurveKeysBody<SpaceFillingCurve::kMorton>,
+                &CurveKeysBody<SpaceFillingCurve::kMorton, true>>()
+          : detail::DispatchKernel<
+                &CurveKeysBody<SpaceFillingCurve::kHilbert>>()};
+  // Coordinates are gathered per block so that the kernel sees arrays.
+  std::array<double, kBlockSize> xs{};
+  std::array<double, kBlockSize> ys{};
+  for (std::size_t first = 0; first < count; first += kBlockSize) {
+    const std::size_t size{std::min(kBlockSize, count - first)};
+    for (std::size_t i = 0; i < size; ++i) {
+      xs[i] = points[first + i].GetX();
+      ys[i] = points[first + i].GetY();
+    }
+    kernel(xs.data(), ys.data(), size, &grid, keys + first);
+  }
+}
+
+auto ComputeCurveOrder(const std::vector<Point2D>& points,
+                       SpaceFillingCurve curve, std::size_t thread_count)
+    -> std::vector<uint32_t> {
+  if (points.size() > std::numeric_limits<uint32_t>::max()) {
+    throw std::invalid_argument("Invalid input: Too many points");
+  }
+  std::vector<uint32_t> order(points.size());
+  std::iota(order.begin(), order.end(), 0U);
+  if (points.empty()) {
+    return order;
+  }
+  BoundingBoxAccumulator box;
+  box.Add(points);
+  const Point2D min_corner{box.GetMinCorner()};
+  const Point2D max_corner{box.GetMaxCorner()};
+  std::vector<uint64_t> keys(points.size());
+  detail::ParallelFor(
+      points.size(), kKeyGrain, thread_count,
+      [&](std::size_t begin, std::size_t end, std::size_t) {
+        ComputeCurveKeys(points.data() + begin, end - begin, min_corner,
+                         max_corner, curve, keys.data() + begin);
+      });
+  detail::RadixSort(keys.data(), order.data(), keys.size(), thread_count);
+  return order;
+}
+
+auto ReorderAlongCurve(std::vector<Point2D>& points, SpaceFillingCurve curve,
+                       std::size_t thread_count) -> std::vector<uint32_t> {
+  std::vector<uint32_t> order{ComputeCurveOrder(points, curve, thread_count)};
+  ApplyPermutation(order, points);
+  return order;
+}
+
+}  // namespace geometry
@@ -0,0 +1,244 @@
+/**
+ * @file geometry/tracked_polyline.cpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Point2D sequence with cached derived geometry refreshed per block
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/tracked_polyline.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "detail/arc_length.hpp"
+
+namespace {
+constexpr std::size_t kMaxPointCount{std::numeric_limits<uint32_t>::max()};
+
+auto GetLeafCount(std::size_t block_count) -> std::size_t {
+  std::size_t leaf_count{1};
+  while (leaf_count < block_count) {
+    leaf_count *= 2;
+  }
+  return leaf_count;
+}
+}  // namespace
+
+namespace geometry {
+
+TrackedPolyline::TrackedPolyline(std::vector<Point2D> points)
+    : points_(std::move(points)) {
+  if (points_.size() > kMaxPointCount) {
+    throw std::invalid_argument("Invalid input: Too many points");
+  }
+  for (std::size_t i = 0; i < points_.size(); ++i) {
+    detail::CheckFinite(points_[i]);
+    if (i + 1 < points_.size()) {
+      length_ = detail::AddLength(
+          length_, detail::SegmentLength(points_[i], points_[i + 1]));
+    }
+  }
+  const std::size_t block_count{(points_.size() + kBlockSize - 1) /
+                                kBlockSize};
+  block_versions_.assign(block_count, 1);
+  refreshed_versions_.assign(block_count, 0);
+  stale_blocks_.resize(block_count);
+  for (std::size_t block = 0; block < block_count; ++block) {
+    stale_blocks_[block] = block;
+  }
+  block_arcs_.resize(points_.size());
+  leaf_count_ = GetLeafCount(block_count);
+  nodes_.assign(2 * leaf_count_, Node());
+}
+
+auto TrackedPolyline::Set(std::size_t index, const Point2D& point) -> void {
+  length_ = CheckEdit(index, point);
+  points_[index] = point;
+  Touch(index);
+}
+
+auto TrackedPolyline::SetX(std::size_t index, double x) -> void {
+  if (index >= points_.size()) {
+    throw std::invalid_argument("Invalid input: Index out of range");
+  }
+  length_ = CheckEdit(index, Point2D(x, points_[index].GetY()));
+  points_[index].SetX(x);
+  Touch(index);
+}
+
+auto TrackedPolyline::SetY(std::size_t index, double y) -> void {
+  if (index >= points_.size()) {
+    throw std::invalid_argument("Invalid input: Index out of range");
+  }
+  length_ = CheckEdit(index, Point2D(points_[index].GetX(), y));
+  points_[index].SetY(y);
+  Touch(index);
+}
+
+auto TrackedPolyline::PushBack(const Point2D& point) -> void {
+  if (points_.size() >= kMaxPointCount) {
+    throw std::invalid_argument("Invalid input: Too many points");
+  }
+  detail::CheckFinite(point);
+  if (!points_.empty()) {
+    length_ = detail::AddLength(length_,
+                                detail::SegmentLength(points_.back(), point));
+  }
+  points_.push_back(point);
+  block_arcs_.push_back(0);
+  if ((points_.size() - 1) % kBlockSize == 0) {
+    Grow();
+  }
+  Touch(points_.size() - 1);
+}
+
+auto TrackedPolyline::Refresh() const -> void {
+  if (stale_blocks_.empty()) {
+    return;
+  }
+  std::sort(stale_blocks_.begin(), stale_blocks_.end());
+  for (auto& block : stale_blocks_) {
+    RefreshBlock(block);
+    refreshed_versions_[block] = block_versions_[block];
+    block += leaf_count_;
+  }
+  // Merge the tree one level at a time, every parent once.
+  auto& nodes{stale_blocks_};
+  while (nodes.front() > 1) {
+    for (auto& node : nodes) {
+      node /= 2;
+    }
+    nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+    for (const auto node : nodes) {
+      MergeChildren(node);
+    }
+  }
+  stale_blocks_.clear();
+}
+
+auto TrackedPolyline::GetBoundingBox() const -> const BoundingBoxAccumulator& {
+  Refresh();
+  return nodes_[1].box;
+}
+
+auto TrackedPolyline::GetCentroid() const -> Point2D {
+  Refresh();
+  return nodes_[1].centroid.GetCentroid();
+}
+
+auto TrackedPolyline::GetLength() const -> Distance {
+  Refresh();
+  return Distance::FromNanometer(nodes_[1].length);
+}
+
+auto TrackedPolyline::GetArcLength(std::size_t index) const -> Distance {
+  if (index >= points_.size()) {
+    throw std::invalid_argument("Invalid input: Index out of range");
+  }
+  Refresh();
+  // Blocks before this one are the left siblings on the path to the root.
+  int64_t arc_length{block_arcs_[index]};
+  for (std::size_t node = leaf_count_ + (index / kBlockSize); node > 1;
+       node /= 2) {
+    if (node % 2 == 1) {
+      arc_length += nodes_[node - 1].length;
+    }
+  }
+  return Distance::FromNanometer(arc_length);
+}
+
+auto TrackedPolyline::CheckEdit(std::size_t index, const Point2D& point) const
+    -> int64_t {
+  if (index >= points_.size()) {
+    throw std::invalid_argument("Invalid input: Index out of range");
+  }
+  detail::CheckFinite(point);
+  // Swap the segments at index in the total; every partial sum the tree
+  // merges stays below it.
+  int64_t length{length_};
+  if (index > 0) {
+    length -= detail::SegmentLength(points_[index - 1], points_[index]);
+  }
+  if (index + 1 < points_.size()) {
+    length -= detail::SegmentLength(points_[index], points_[index + 1]);
+  }
+  if (index > 0) {
+    length = detail::AddLength(
+        length, detail::SegmentLength(points_[index - 1], point));
+  }
+  if (index + 1 < points_.size()) {
+    length = detail::AddLength(
+        length, detail::SegmentLength(point, points_[index + 1]));
+  }
+  return length;
+}
+
+auto TrackedPolyline::Touch(std::size_t index) -> void {
+  const std::size_t block{index / kBlockSize};
+  MarkStale(block);
+  // The segment arriving at the first point leaves the previous block.
+  if (index % kBlockSize == 0 && block > 0) {
+    MarkStale(block - 1);
+  }
+  ++version_;
+}
+
+auto TrackedPolyline::MarkStale(std::size_t block) -> void {
+  if (block_versions_[block] == refreshed_versions_[block]) {
+    stale_blocks_.push_back(block);
+  }
+  ++block_versions_[block];
+}
+
+auto TrackedPolyline::RefreshBlock(std::size_t block) const -> void {
+  const std::size_t begin{block * kBlockSize};
+  const std::size_t end{std::min(begin + kBlockSize, points_.size())};
+  Node leaf;
+  leaf.box.Add(points_.data() + begin, end - begin);
+  leaf.centroid.Add(points_.data() + begin, end - begin);
+  for (std::size_t i = begin; i < end; ++i) {
+    block_arcs_[i] = leaf.length;
+    if (i + 1 < points_.size()) {
+      leaf.length += detail::SegmentLength(points_[i], points_[i + 1]);
+    }
+  }
+  nodes_[leaf_count_ + block] = leaf;
+}
+
+auto TrackedPolyline::Grow() -> void {
+  block_versions_.push_back(0);
+  refreshed_versions_.push_back(0);
+  if (block_versions_.size() <= leaf_count_) {
+    return;
+  }
+  // Double the leaves and merge the levels above them again.
+  std::vector<Node> nodes(4 * leaf_count_);
+  std::copy(nodes_.begin() + static_cast<std::ptrdiff_t>(leaf_count_),
+            nodes_.end(),
+            nodes.begin() + static_cast<std::ptrdiff_t>(2 * leaf_count_));
+  leaf_count_ *= 2;
+  nodes_ = std::move(nodes);
+  for (std::size_t node = leaf_count_ - 1; node >= 1; --node) {
+    MergeChildren(node);
+  }
+}
+
+auto TrackedPolyline::MergeChildren(std::size_t node) const -> void {
+  const Node& left{nodes_[2 * node]};
+  const Node& right{nodes_[(2 * node) + 1]};
+  Node& parent{nodes_[node]};
+  parent.box = left.box;
+  parent.box.Merge(right.box);
+  parent.centroid = left.centroid;
+  parent.centroid.Merge(right.centroid);
+  parent.length = left.length + right.length;
+}
+
+}  // namespace geometry
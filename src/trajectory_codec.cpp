@@ -0,0 +1,381 @@
+/**
+ * @file geometry/trajectory_codec.cpp
+ * @author Jeonghoon Park (ses88498@gmail.com)
+ * @brief Quantised delta and bit-packing codec for Point2D trajectories
+ * @version 1.0.0
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2023 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/trajectory_codec.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+constexpr uint8_t kMagic{'T'};
+constexpr uint8_t kVersion{1};
+constexpr std::size_t kMaxVarintSize{10};
+constexpr std::size_t kBlockHeaderSize{3};
+constexpr unsigned kMaxWidth{64};
+// Unpacking loads 8 bytes at a time, up to two words past the last value, so
+// the decoder keeps this many zero bytes behind its buffer while decoding.
+constexpr std::size_t kPadding{16};
+// Quantised coordinates are kept below 2^62 in magnitude so that the delta of
+// two of them always fits the 64-bit zigzag range.
+constexpr double kMaxQuantised{4.611686018427387904e18};
+constexpr double kMeterToNanometer{1.0e9};
+constexpr double kNanometerToMeter{1.0e-9};
+
+auto Quantise(double value, double inverse_resolution) -> int64_t {
+  const double scaled{value * inverse_resolution};
+  if (!std::isfinite(scaled) || std::abs(scaled) >= kMaxQuantised) {
+    throw std::invalid_argument("Invalid input: Coordinate out of range");
+  }
+  return std::llround(scaled);
+}
+
+auto CheckPoint(const geometry::Point2D& point, double inverse_resolution)
+    -> void {
+  static_cast<void>(Quantise(point.GetX(), inverse_resolution));
+  static_cast<void>(Quantise(point.GetY(), inverse_resolution));
+}
+
+inline auto ZigZag(uint64_t delta) -> uint64_t {
+  return (delta << 1U) ^ (0U - (delta >> 63U));
+}
+
+inline auto UnZigZag(uint64_t value) -> uint64_t {
+  return (value >> 1U) ^ (0U - (value & 1U));
+}
+
+auto BitWidth(uint64_t value) -> unsigned {
+  unsigned width{0};
+  while (value != 0) {
+    ++width;
+    value >>= 1U;
+  }
+  return width;
+}
+
+inline auto PackedSize(std::size_t count, unsigned width) -> std::size_t {
+  return ((count * width) + 7) / 8;
+}
+
+auto AppendWord(std::vector<uint8_t>& bytes, uint64_t word, std::size_t size)
+    -> void {
+  for (std::size_t i = 0; i < size; ++i) {
+    bytes.push_back(static_cast<uint8_t>(word >> (8 * i)));
+  }
+}
+
+/**
+ * @brief Append values of the given bit width, least significant bit first.
+ */
+auto Pack(const uint64_t* values, std::size_t count, unsigned width,
+          std::vector<uint8_t>& bytes) -> void {
+  if (width == 0) {
+    return;
+  }
+  uint64_t word{0};
+  unsigned used{0};
+  for (std::size_t i = 0; i < count; ++i) {
+    word |= values[i] << used;
+    const unsigned total{used + width};
+    if (total < kMaxWidth) {
+      used = total;
+      continue;
+    }
+    AppendWord(bytes, word, sizeof(word));
+    word = used == 0 ? 0 : values[i] >> (kMaxWidth - used);
+    used = total - kMaxWidth;
+  }
+  AppendWord(bytes, word, (used + 7) / 8);
+}
+
+inline auto Load(const uint8_t* bytes) -> uint64_t {
+  uint64_t word;
+  std::memcpy(&word, bytes, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  word = __builtin_bswap64(word);
+#endif
+  return word;
+}
+
+/**
+ * @brief Unpack count values of the given bit width. Reads up to kPadding
+ * bytes past the packed values.
+ */
+auto Unpack(const uint8_t* bytes, std::size_t count, unsigned width,
+            uint64_t* values) -> void {
+  if (width == 0) {
+    std::fill(values, values + count, 0);
+    return;
+  }
+  const uint64_t mask{width == kMaxWidth ? ~uint64_t{0}
+                                         : (uint64_t{1} << width) - 1};
+  if (width <= kMaxWidth - 7) {
+    // Every value lies within the 8 bytes from its first byte.
+    for (std::size_t i = 0; i < count; ++i) {
+      const std::size_t bit{i * width};
+      values[i] = (Load(bytes + (bit / 8)) >> (bit % 8)) & mask;
+    }
+    return;
+  }
+  for (std::size_t i = 0; i < count; ++i) {
+    const std::size_t bit{i * width};
+    const auto shift{static_cast<unsigned>(bit % 8)};
+    uint64_t value{Load(bytes + (bit / 8)) >> shift};
+    if (shift != 0) {
+      value |= Load(bytes + (bit / 8) + 8) << (kMaxWidth - shift);
+    }
+    values[i] = value & mask;
+  }
+}
+}  // namespace
+
+namespace geometry {
+
+TrajectoryEncoder::TrajectoryEncoder(const Distance& resolution) {
+  const double nanometers{resolution.GetValue(Distance::Type::kNanometer)};
+  if (nanometers <= 0.0) {
+    throw std::invalid_argument("Invalid input: Non-positive resolution");
+  }
+  inverse_resolution_ = kMeterToNanometer / nanometers;
+  bytes_.push_back(kMagic);
+  bytes_.push_back(kVersion);
+  auto varint{static_cast<uint64_t>(nanometers)};
+  while (varint >= 0x80) {
+    bytes_.push_back(static_cast<uint8_t>(varint | 0x80));
+    varint >>= 7U;
+  }
+  bytes_.push_back(static_cast<uint8_t>(varint));
+}
+
+auto TrajectoryEncoder::Add(const Point2D& point) -> void {
+  const int64_t x{Quantise(point.GetX(), inverse_resolution_)};
+  const int64_t y{Quantise(point.GetY(), inverse_resolution_)};
+  xs_[pending_] = x;
+  ys_[pending_] = y;
+  ++point_count_;
+  if (++pending_ == kBlockSize) {
+    Flush();
+  }
+}
+
+auto TrajectoryEncoder::Add(const std::vector<Point2D>& points) -> void {
+  // Check the whole batch first so that a bad point adds nothing.
+  for (const auto& point : points) {
+    CheckPoint(point, inverse_resolution_);
+  }
+  for (const auto& point : points) {
+    Add(point);
+  }
+}
+
+auto TrajectoryEncoder::Flush() -> void {
+  if (pending_ == 0) {
+    return;
+  }
+  std::array<uint64_t, kBlockSize> dxs{};
+  std::array<uint64_t, kBlockSize> dys{};
+  uint64_t x_bits{0};
+  uint64_t y_bits{0};
+  auto previous_x{static_cast<uint64_t>(previous_x_)};
+  auto previous_y{static_cast<uint64_t>(previous_y_)};
+  for (std::size_t i = 0; i < pending_; ++i) {
+    const auto x{static_cast<uint64_t>(xs_[i])};
+    const auto y{static_cast<uint64_t>(ys_[i])};
+    dxs[i] = ZigZag(x - previous_x);
+    dys[i] = ZigZag(y - previous_y);
+    x_bits |= dxs[i];
+    y_bits |= dys[i];
+    previous_x = x;
+    previous_y = y;
+  }
+  const unsigned x_width{BitWidth(x_bits)};
+  const unsigned y_width{BitWidth(y_bits)};
+  bytes_.push_back(static_cast<uint8_t>(pending_));
+  bytes_.push_back(static_cast<uint8_t>(x_width));
+  bytes_.push_back(static_cast<uint8_t>(y_width));
+  Pack(dxs.data(), pending_, x_width, bytes_);
+  Pack(dys.data(), pending_, y_width, bytes_);
+  previous_x_ = xs_[pending_ - 1];
+  previous_y_ = ys_[pending_ - 1];
+  pending_ = 0;
+}
+
+auto TrajectoryEncoder::TakeBytes() -> std::vector<uint8_t> {
+  std::vector<uint8_t> bytes;
+  bytes.swap(bytes_);
+  return bytes;
+}
+
+auto TrajectoryDecoder::Feed(const uint8_t* data, std::size_t size) -> void {
+  // Drop the decoded prefix before appending.
+  buffer_.erase(buffer_.begin(),
+                buffer_.begin() + static_cast<std::ptrdiff_t>(offset_));
+  offset_ = 0;
+  buffer_.insert(buffer_.end(), data, data + size);
+}
+
+auto TrajectoryDecoder::ReadHeader() -> bool {
+  const std::size_t size{buffer_.size() - offset_};
+  if (size < 3) {
+    return false;
+  }
+  const uint8_t* bytes{buffer_.data() + offset_};
+  if (bytes[0] != kMagic || bytes[1] != kVersion) {
+    throw std::invalid_argument("Invalid input: Unsupported trajectory format");
+  }
+  uint64_t value{0};
+  for (std::size_t i = 2; i < size; ++i) {
+    if (i - 2 == kMaxVarintSize) {
+      break;
+    }
+    value |= static_cast<uint64_t>(bytes[i] & 0x7FU) << (7 * (i - 2));
+    if ((bytes[i] & 0x80U) != 0) {
+      continue;
+    }
+    if (value == 0 ||
+        value > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+      throw std::invalid_argument("Invalid input: Invalid resolution");
+    }
+    resolution_ = static_cast<int64_t>(value);
+    resolution_meter_ = static_cast<double>(resolution_) * kNanometerToMeter;
+    has_header_ = true;
+    offset_ += i + 1;
+    return true;
+  }
+  if (size - 2 >= kMaxVarintSize) {
+    throw std::invalid_argument("Invalid input: Invalid resolution");
+  }
+  return false;
+}
+
+auto TrajectoryDecoder::FindBlocks(std::size_t& end) -> std::size_t {
+  if (!has_header_ && !ReadHeader()) {
+    return 0;
+  }
+  const std::size_t size{buffer_.size()};
+  std::size_t count{0};
+  end = offset_;
+  while (size - end >= kBlockHeaderSize) {
+    const uint8_t* header{buffer_.data() + end};
+    if (header[0] == 0 || header[0] > TrajectoryEncoder::kBlockSize ||
+        header[1] > kMaxWidth || header[2] > kMaxWidth) {
+      throw std::invalid_argument("Invalid input: Corrupt trajectory block");
+    }
+    const std::size_t block{kBlockHeaderSize +
+                            PackedSize(header[0], header[1]) +
+                            PackedSize(header[0], header[2])};
+    if (size - end < block) {
+      break;
+    }
+    end += block;
+    count += header[0];
+  }
+  return count;
+}
+
+auto TrajectoryDecoder::DecodeBlock(double* xs, double* ys) -> std::size_t {
+  std::array<uint64_t, TrajectoryEncoder::kBlockSize> dxs;
+  std::array<uint64_t, TrajectoryEncoder::kBlockSize> dys;
+  const uint8_t* header{buffer_.data() + offset_};
+  const std::size_t count{header[0]};
+  const unsigned x_width{header[1]};
+  const unsigned y_width{header[2]};
+  const uint8_t* packed{header + kBlockHeaderSize};
+  Unpack(packed, count, x_width, dxs.data());
+  packed += PackedSize(count, x_width);
+  Unpack(packed, count, y_width, dys.data());
+  packed += PackedSize(count, y_width);
+  uint64_t x{previous_x_};
+  uint64_t y{previous_y_};
+  for (std::size_t i = 0; i < count; ++i) {
+    x += UnZigZag(dxs[i]);
+    y += UnZigZag(dys[i]);
+    xs[i] = static_cast<double>(static_cast<int64_t>(x)) * resolution_meter_;
+    ys[i] = static_cast<double>(static_cast<int64_t>(y)) * resolution_meter_;
+  }
+  previous_x_ = x;
+  previous_y_ = y;
+  offset_ = static_cast<std::size_t>(packed - buffer_.data());
+  return count;
+}
+
+auto TrajectoryDecoder::Read(std::vector<Point2D>& points) -> std::size_t {
+  std::size_t end{0};
+  const std::size_t count{FindBlocks(end)};
+  if (count == 0) {
+    return 0;
+  }
+  points.reserve(points.size() + count);
+  const std::size_t size{buffer_.size()};
+  buffer_.resize(size + kPadding);
+  std::array<double, TrajectoryEncoder::kBlockSize> xs;
+  std::array<double, TrajectoryEncoder::kBlockSize> ys;
+  while (offset_ < end) {
+    const std::size_t block_count{DecodeBlock(xs.data(), ys.data())};
+    for (std::size_t i = 0; i < block_count; ++i) {
+      points.emplace_back(xs[i], ys[i]);
+    }
+  }
+  buffer_.resize(size);
+  return count;
+}
+
+auto TrajectoryDecoder::Read(std::vector<double>& xs, std::vector<double>& ys)
+    -> std::size_t {
+  std::size_t end{0};
+  const std::size_t count{FindBlocks(end)};
+  if (count == 0) {
+    return 0;
+  }
+  std::size_t first{xs.size()};
+  xs.resize(first + count);
+  ys.resize(first + count);
+  const std::size_t size{buffer_.size()};
+  buffer_.resize(size + kPadding);
+  while (offset_ < end) {
+    first += DecodeBlock(xs.data() + first, ys.data() + first);
+  }
+  buffer_.resize(size);
+  return count;
+}
+
+auto TrajectoryDecoder::GetResolution() const -> Distance {
+  if (!has_header_) {
+    throw std::logic_error("Invalid state: Trajectory header not read");
+  }
+  return Distance(static_cast<double>(resolution_),
+                  Distance::Type::kNanometer);
+}
+
+auto EncodeTrajectory(const std::vector<Point2D>& points,
+                      const Distance& resolution) -> std::vector<uint8_t> {
+  TrajectoryEncoder encoder(resolution);
+  encoder.Add(points);
+  encoder.Flush();
+  return encoder.TakeBytes();
+}
+
+auto DecodeTrajectory(const std::vector<uint8_t>& bytes)
+    -> std::vector<Point2D> {
+  TrajectoryDecoder decoder;
+  decoder.Feed(bytes);
+  std::vector<Point2D> points;
+  static_cast<void>(decoder.Read(points));
+  if (bytes.empty() || !decoder.IsIdle()) {
+    throw std::invalid_argument("Invalid input: Truncated trajectory");
+  }
+  return points;
+}
+
+}  // namespace geometry
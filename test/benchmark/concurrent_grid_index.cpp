@@ -0,0 +1,121 @@
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+// Query throughput of ConcurrentGridIndex while one writer keeps moving
+// objects in batches, for 1, 2, 4, ... reader threads up to the core count.
+// Usage: GEOMETRY_BENCHMARK_CONCURRENT_GRID_INDEX [seconds per step]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "geometry/concurrent_grid_index.hpp"
+
+namespace {
+constexpr uint32_t kObjectCount = 200000U;
+constexpr std::size_t kBatchSize = 1000U;
+constexpr double kExtent = 10000.0;
+constexpr double kCellSize = 100.0;
+constexpr double kRadius = 150.0;
+
+struct StepResult {
+  double queries_per_second;
+  double matches_per_query;
+  double updates_per_second;
+};
+
+auto RunStep(geometry::ConcurrentGridIndex& index, std::size_t reader_count,
+             double seconds) -> StepResult {
+  std::atomic<bool> done{false};
+  std::atomic<std::size_t> queries{0};
+  std::atomic<std::size_t> matches{0};
+  std::atomic<std::size_t> updates{0};
+  std::vector<std::thread> readers;
+  for (std::size_t reader = 0; reader < reader_count; ++reader) {
+    readers.emplace_back([&, reader] {
+      std::mt19937 random(static_cast<uint32_t>(reader));
+      std::uniform_real_distribution<double> coordinate(0.0, kExtent);
+      std::size_t local{0};
+      std::size_t found{0};
+      while (!done.load(std::memory_order_relaxed)) {
+        index.ForEachInRadius(
+            geometry::Point2D(coordinate(random), coordinate(random)),
+            geometry::Distance(kRadius), [&found](uint32_t, double) {
+              ++found;
+            });
+        ++local;
+      }
+      queries.fetch_add(local);
+      matches.fetch_add(found);
+    });
+  }
+  std::thread writer([&] {
+    std::mt19937 random(7);
+    std::uniform_real_distribution<double> coordinate(0.0, kExtent);
+    std::uniform_int_distribution<uint32_t> id(0, kObjectCount - 1);
+    std::vector<geometry::PositionUpdate> batch(kBatchSize);
+    while (!done.load(std::memory_order_relaxed)) {
+      for (auto& update : batch) {
+        update = {id(random),
+                  geometry::Point2D(coordinate(random), coordinate(random))};
+      }
+      index.Update(batch);
+      updates.fetch_add(batch.size());
+    }
+  });
+
+  const auto start{std::chrono::steady_clock::now()};
+  std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+  done.store(true);
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  writer.join();
+  const double elapsed{std::chrono::duration<double>(
+                           std::chrono::steady_clock::now() - start)
+                           .count()};
+  const auto query_count{static_cast<double>(queries.load())};
+  return {query_count / elapsed,
+          static_cast<double>(matches.load()) / std::max(1.0, query_count),
+          static_cast<double>(updates.load()) / elapsed};
+}
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+  const double seconds{argc > 1 ? std::atof(argv[1]) : 1.0};
+  geometry::ConcurrentGridIndex index(
+      geometry::Point2D(0.0, 0.0), geometry::Point2D(kExtent, kExtent),
+      geometry::Distance(kCellSize), kObjectCount);
+  std::mt19937 random(1);
+  std::uniform_real_distribution<double> coordinate(0.0, kExtent);
+  std::vector<geometry::PositionUpdate> initial;
+  for (uint32_t id = 0; id < kObjectCount; ++id) {
+    initial.push_back(
+        {id, geometry::Point2D(coordinate(random), coordinate(random))});
+  }
+  index.Update(initial);
+
+  const std::size_t cores{
+      std::max<std::size_t>(1, std::thread::hardware_concurrency())};
+  std::printf("%zu objects, radius %.0f m, writer batches of %zu\n",
+              static_cast<std::size_t>(kObjectCount), kRadius, kBatchSize);
+  std::printf("%8s %14s %14s %10s %12s\n", "readers", "queries/s",
+              "per reader/s", "matches", "updates/s");
+  for (std::size_t readers = 1;; readers *= 2) {
+    readers = std::min(readers, cores);
+    const StepResult result{RunStep(index, readers, seconds)};
+    std::printf("%8zu %14.0f %14.0f %10.1f %12.0f\n", readers,
+                result.queries_per_second,
+                result.queries_per_second / static_cast<double>(readers),
+                result.matches_per_query, result.updates_per_second);
+    if (readers == cores) {
+      break;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,113 @@
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+// Cost of the trivial Point2D and Distance members in caller loops, next to
+// the same loops over plain doubles and integers. Build once with
+// GEOMETRY_INLINE_HOT_PATH OFF and once ON, or with GEOMETRY_ENABLE_IPO, to
+// compare out-of-line calls with inlined, vectorised code.
+// Usage: GEOMETRY_BENCHMARK_HOT_PATH [repetitions]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/point2d.hpp"
+
+namespace {
+constexpr std::size_t kCount = std::size_t{1} << 20;
+
+template <typename Function>
+auto Measure(const char* name, int repetitions, Function&& function)
+    -> void {
+  double checksum{0.0};
+  const auto start{std::chrono::steady_clock::now()};
+  for (int repetition = 0; repetition < repetitions; ++repetition) {
+    checksum += function();
+  }
+  const double nanoseconds{std::chrono::duration<double, std::nano>(
+                               std::chrono::steady_clock::now() - start)
+                               .count()};
+  std::printf("%-28s %8.3f ns/element (checksum %g)\n", name,
+              nanoseconds / (static_cast<double>(kCount) * repetitions),
+              checksum);
+}
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+  const int repetitions{argc > 1 ? std::atoi(argv[1]) : 50};
+#if defined(GEOMETRY_INLINE_HOT_PATH)
+  std::printf("mode: inline hot path\n");
+#else
+  std::printf("mode: out-of-line hot path\n");
+#endif
+  std::mt19937_64 random(1);
+  std::uniform_real_distribution<double> coordinate(0.0, 1000.0);
+  std::vector<geometry::Point2D> points;
+  std::vector<double> xs;
+  std::vector<double> ys;
+  std::vector<geometry::Distance> distances;
+  std::vector<int64_t> nanometers;
+  for (std::size_t i = 0; i < kCount; ++i) {
+    points.emplace_back(coordinate(random), coordinate(random));
+    xs.push_back(points.back().GetX());
+    ys.push_back(points.back().GetY());
+    distances.emplace_back(coordinate(random));
+    nanometers.push_back(distances.back().GetNanometer());
+  }
+  const geometry::Point2D offset(0.5, -0.25);
+  const geometry::Distance threshold(500.0);
+
+  Measure("Point2D GetX * GetY", repetitions, [&] {
+    double sum{0.0};
+    for (const auto& point : points) {
+      sum += point.GetX() * point.GetY();
+    }
+    return sum;
+  });
+  Measure("double x * y", repetitions, [&] {
+    double sum{0.0};
+    for (std::size_t i = 0; i < kCount; ++i) {
+      sum += xs[i] * ys[i];
+    }
+    return sum;
+  });
+  Measure("Point2D += offset", repetitions, [&] {
+    for (auto& point : points) {
+      point += offset;
+    }
+    return points[0].GetX();
+  });
+  Measure("double += offset", repetitions, [&] {
+    for (std::size_t i = 0; i < kCount; ++i) {
+      xs[i] += 0.5;
+      ys[i] -= 0.25;
+    }
+    return xs[0];
+  });
+  Measure("Point2D (p - o) * 2", repetitions, [&] {
+    geometry::Point2D sum;
+    for (const auto& point : points) {
+      sum += (point - offset) * 2.0;
+    }
+    return sum.GetX();
+  });
+  Measure("Distance < threshold", repetitions, [&] {
+    std::size_t count{0};
+    for (const auto& distance : distances) {
+      count += distance < threshold ? 1 : 0;
+    }
+    return static_cast<double>(count);
+  });
+  Measure("int64_t < threshold", repetitions, [&] {
+    std::size_t count{0};
+    const int64_t limit{threshold.GetNanometer()};
+    for (const auto nanometer : nanometers) {
+      count += nanometer < limit ? 1 : 0;
+    }
+    return static_cast<double>(count);
+  });
+  return 0;
+}
@@ -0,0 +1,96 @@
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+// Cost of scattered 10-vertex edits on a 1M-vertex TrackedPolyline followed
+// by bounding box, centroid and length queries, next to a full rescan of the
+// same quantities.
+// Usage: GEOMETRY_BENCHMARK_TRACKED_POLYLINE [repetitions]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "geometry/accumulators.hpp"
+#include "geometry/tracked_polyline.hpp"
+
+namespace {
+constexpr std::size_t kPointCount = std::size_t{1} << 20;
+constexpr std::size_t kEditCount = 10U;
+
+using Clock = std::chrono::steady_clock;
+
+auto Microseconds(Clock::duration duration, int repetitions) -> double {
+  return std::chrono::duration<double, std::micro>(duration).count() /
+         repetitions;
+}
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+  const int repetitions{argc > 1 ? std::atoi(argv[1]) : 1000};
+  std::mt19937_64 random(1);
+  std::uniform_real_distribution<double> step(-10.0, 10.0);
+  std::vector<geometry::Point2D> points;
+  double x{0.0};
+  double y{0.0};
+  for (std::size_t i = 0; i < kPointCount; ++i) {
+    x += step(random);
+    y += step(random);
+    points.emplace_back(x, y);
+  }
+  std::uniform_int_distribution<std::size_t> index(0, kPointCount - 1);
+  double checksum{0.0};
+
+  const int rescans{std::max(1, repetitions / 100)};
+  auto start{Clock::now()};
+  for (int repetition = 0; repetition < rescans; ++repetition) {
+    points[index(random)].SetX(step(random));
+    geometry::BoundingBoxAccumulator box;
+    box.Add(points);
+    geometry::CentroidAccumulator centroid;
+    centroid.Add(points);
+    double length{0.0};
+    for (std::size_t i = 0; i + 1 < kPointCount; ++i) {
+      length += points[i].CalculateDistance(points[i + 1]);
+    }
+    checksum += box.GetMaxCorner().GetX() + centroid.GetCentroid().GetX() +
+                length;
+  }
+  std::printf("%-34s %10.2f us\n", "full rescan",
+              Microseconds(Clock::now() - start, rescans));
+
+  start = Clock::now();
+  geometry::TrackedPolyline polyline(points);
+  polyline.Refresh();
+  std::printf("%-34s %10.2f us\n", "build and first refresh",
+              Microseconds(Clock::now() - start, 1));
+
+  start = Clock::now();
+  for (int repetition = 0; repetition < repetitions; ++repetition) {
+    for (std::size_t edit = 0; edit < kEditCount; ++edit) {
+      polyline.SetX(index(random), step(random));
+    }
+    checksum += polyline.GetBoundingBox().GetMaxCorner().GetX() +
+                polyline.GetCentroid().GetX() +
+                polyline.GetLength().GetValue(geometry::Distance::Type::kMeter);
+  }
+  std::printf("%-34s %10.2f us\n", "10 scattered edits and queries",
+              Microseconds(Clock::now() - start, repetitions));
+
+  start = Clock::now();
+  for (int repetition = 0; repetition < repetitions; ++repetition) {
+    const std::size_t first{index(random) % (kPointCount - kEditCount)};
+    for (std::size_t edit = 0; edit < kEditCount; ++edit) {
+      polyline.SetY(first + edit, step(random));
+    }
+    checksum += polyline.GetBoundingBox().GetMinCorner().GetY() +
+                polyline.GetCentroid().GetY() +
+                polyline.GetLength().GetValue(geometry::Distance::Type::kMeter);
+  }
+  std::printf("%-34s %10.2f us\n", "10 adjacent edits and queries",
+              Microseconds(Clock::now() - start, repetitions));
+  std::printf("checksum %g\n", checksum);
+  return 0;
+}
@@ -0,0 +1,130 @@
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+// Size and throughput of the trajectory codec on a vehicle-like trace: 1M
+// points about 20 m apart with a slowly turning heading, at 1 cm resolution.
+// Decoding is measured into coordinate arrays, into Point2D and fed in 4 KiB
+// pieces, and for a 16K-point trace whose input and output stay in cache.
+// Usage: GEOMETRY_BENCHMARK_TRAJECTORY_CODEC [repetitions]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "geometry/trajectory_codec.hpp"
+
+namespace {
+constexpr std::size_t kPointCount = std::size_t{1} << 20;
+constexpr std::size_t kPieceSize = 4096U;
+constexpr std::size_t kHotPointCount = std::size_t{1} << 14;
+constexpr double kResolution = 0.01;
+
+auto MakeTrace() -> std::vector<geometry::Point2D> {
+  std::mt19937_64 random(1);
+  std::normal_distribution<double> turn(0.0, 0.05);
+  std::uniform_real_distribution<double> speed(15.0, 25.0);
+  std::vector<geometry::Point2D> points;
+  points.reserve(kPointCount);
+  double x{312000.0};
+  double y{4150000.0};
+  double heading{0.0};
+  for (std::size_t i = 0; i < kPointCount; ++i) {
+    heading += turn(random);
+    const double step{speed(random)};
+    x += step * std::cos(heading);
+    y += step * std::sin(heading);
+    points.emplace_back(x, y);
+  }
+  return points;
+}
+
+template <typename Function>
+auto Measure(const char* name, int repetitions, Function&& function,
+             std::size_t point_count = kPointCount) -> void {
+  std::size_t checksum{0};
+  const auto start{std::chrono::steady_clock::now()};
+  for (int repetition = 0; repetition < repetitions; ++repetition) {
+    checksum += function();
+  }
+  const double seconds{std::chrono::duration<double>(
+                           std::chrono::steady_clock::now() - start)
+                           .count()};
+  std::printf("%-28s %8.1f M points/s (checksum %zu)\n", name,
+              static_cast<double>(point_count) * repetitions / seconds / 1e6,
+              checksum);
+}
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+  const int repetitions{argc > 1 ? std::atoi(argv[1]) : 20};
+  const auto points{MakeTrace()};
+  const geometry::Distance resolution(kResolution);
+  const auto bytes{geometry::EncodeTrajectory(points, resolution)};
+  std::printf("%-28s %8.2f bytes/point (%.1fx smaller than 2 doubles)\n",
+              "size", static_cast<double>(bytes.size()) / kPointCount,
+              16.0 * kPointCount / static_cast<double>(bytes.size()));
+
+  Measure("encode", repetitions, [&] {
+    return geometry::EncodeTrajectory(points, resolution).size();
+  });
+  std::vector<double> xs;
+  std::vector<double> ys;
+  xs.reserve(kPointCount);
+  ys.reserve(kPointCount);
+  Measure("decode into x, y arrays", repetitions, [&] {
+    xs.clear();
+    ys.clear();
+    geometry::TrajectoryDecoder decoder;
+    decoder.Feed(bytes);
+    return decoder.Read(xs, ys);
+  });
+  std::vector<geometry::Point2D> decoded;
+  decoded.reserve(kPointCount);
+  Measure("decode into Point2D", repetitions, [&] {
+    decoded.clear();
+    geometry::TrajectoryDecoder decoder;
+    decoder.Feed(bytes);
+    return decoder.Read(decoded);
+  });
+  Measure("decode 4 KiB pieces", repetitions, [&] {
+    xs.clear();
+    ys.clear();
+    geometry::TrajectoryDecoder decoder;
+    std::size_t count{0};
+    for (std::size_t offset = 0; offset < bytes.size(); offset += kPieceSize) {
+      decoder.Feed(bytes.data() + offset,
+                   std::min(kPieceSize, bytes.size() - offset));
+      count += decoder.Read(xs, ys);
+    }
+    return count;
+  });
+
+  const auto hot_bytes{geometry::EncodeTrajectory(
+      std::vector<geometry::Point2D>(points.begin(),
+                                     points.begin() + kHotPointCount),
+      resolution)};
+  Measure(
+      "decode 16K points, in cache", repetitions * 64,
+      [&] {
+        xs.clear();
+        ys.clear();
+        geometry::TrajectoryDecoder decoder;
+        decoder.Feed(hot_bytes);
+        return decoder.Read(xs, ys);
+      },
+      kHotPointCount);
+
+  const auto round_trip{geometry::DecodeTrajectory(bytes)};
+  double error{0.0};
+  for (std::size_t i = 0; i < kPointCount; ++i) {
+    error = std::max(
+        {error, std::abs(round_trip[i].GetX() - points[i].GetX()),
+         std::abs(round_trip[i].GetY() - points[i].GetY())});
+  }
+  std::printf("%-28s %8.4f m\n", "max coordinate error", error);
+  return 0;
+}
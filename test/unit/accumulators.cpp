@@ -0,0 +1,225 @@
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/accumulators.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 20U;
+constexpr std::size_t kPointCount = 10000U;
+
+auto MakeRandomPoints(std::size_t count, double offset)
+    -> std::vector<geometry::Point2D> {
+  std::vector<geometry::Point2D> points;
+  for (std::size_t i = 0; i < count; ++i) {
+    points.emplace_back(
+        offset + (static_cast<double>(std::rand()) / RAND_MAX * 100.0),
+        offset + (static_cast<double>(std::rand()) / RAND_MAX * 50.0));
+  }
+  return points;
+}
+
+struct Reference {
+  long double mean_x{0.0L};
+  long double mean_y{0.0L};
+  long double xx{0.0L};
+  long double xy{0.0L};
+  long double yy{0.0L};
+};
+
+auto ComputeReference(const std::vector<geometry::Point2D>& points)
+    -> Reference {
+  Reference reference;
+  for (const auto& point : points) {
+    reference.mean_x += point.GetX();
+    reference.mean_y += point.GetY();
+  }
+  const auto count{static_cast<long double>(points.size())};
+  reference.mean_x /= count;
+  reference.mean_y /= count;
+  for (const auto& point : points) {
+    const long double dx{point.GetX() - reference.mean_x};
+    const long double dy{point.GetY() - reference.mean_y};
+    reference.xx += dx * dx;
+    reference.xy += dx * dy;
+    reference.yy += dy * dy;
+  }
+  reference.xx /= count;
+  reference.xy /= count;
+  reference.yy /= count;
+  return reference;
+}
+}  // namespace
+
+namespace geometry {
+
+TEST(GeometryAccumulators, CentroidIsCompensated) {
+  // Far from the origin a plain running sum loses the fractional parts.
+  const auto points{MakeRandomPoints(kPointCount * 10, 1.0e9)};
+  const Reference reference{ComputeReference(points)};
+  CentroidAccumulator accumulator;
+  accumulator.Add(points);
+  const Point2D centroid{accumulator.GetCentroid()};
+  EXPECT_EQ(points.size(), accumulator.GetCount());
+  EXPECT_NEAR(static_cast<double>(reference.mean_x), centroid.GetX(), 1e-6);
+  EXPECT_NEAR(static_cast<double>(reference.mean_y), centroid.GetY(), 1e-6);
+
+  CentroidAccumulator single;
+  for (const auto& point : points) {
+    single.Add(point);
+  }
+  EXPECT_EQ(centroid.GetX(), single.GetCentroid().GetX());
+  EXPECT_EQ(centroid.GetY(), single.GetCentroid().GetY());
+}
+
+TEST(GeometryAccumulators, BoundingBoxAndDistanceRange) {
+  for (uint32_t test = 0; test < kTestCount; ++test) {
+    const auto points{MakeRandomPoints(kPointCount / 10, -20.0)};
+    const Point2D reference(10.0, 5.0);
+    BoundingBoxAccumulator box;
+    DistanceRangeAccumulator range(reference);
+    box.Add(points);
+    for (const auto& point : points) {
+      range.Add(point);
+    }
+    double min_x{points[0].GetX()};
+    double max_y{points[0].GetY()};
+    double nearest{reference.CalculateDistance(points[0])};
+    double farthest{nearest};
+    for (const auto& point : points) {
+      min_x = std::min(min_x, point.GetX());
+      max_y = std::max(max_y, point.GetY());
+      nearest = std::min(nearest, reference.CalculateDistance(point));
+      farthest = std::max(farthest, reference.CalculateDistance(point));
+    }
+    EXPECT_EQ(min_x, box.GetMinCorner().GetX());
+    EXPECT_EQ(max_y, box.GetMaxCorner().GetY());
+    EXPECT_EQ(Distance(nearest), range.GetMin());
+    EXPECT_EQ(Distance(farthest), range.GetMax());
+    EXPECT_EQ(points.size(), range.GetCount());
+  }
+}
+
+TEST(GeometryAccumulators, CovarianceMatchesTwoPass) {
+  for (uint32_t test = 0; test < kTestCount; ++test) {
+    const auto points{MakeRandomPoints(kPointCount, 1.0e6)};
+    const Reference reference{ComputeReference(points)};
+    CovarianceAccumulator span;
+    span.Add(points);
+    CovarianceAccumulator single;
+    for (const auto& point : points) {
+      single.Add(point);
+    }
+    for (const auto& accumulator : {span, single}) {
+      const auto covariance{accumulator.GetCovariance()};
+      EXPECT_NEAR(static_cast<double>(reference.xx), covariance.xx, 1e-6);
+      EXPECT_NEAR(static_cast<double>(reference.xy), covariance.xy, 1e-6);
+      EXPECT_NEAR(static_cast<double>(reference.yy), covariance.yy, 1e-6);
+      EXPECT_NEAR(static_cast<double>(reference.mean_x),
+                  accumulator.GetMean().GetX(), 1e-8);
+    }
+    const auto sample{span.GetSampleCovariance()};
+    EXPECT_NEAR(static_cast<double>(reference.xx) *
+                    static_cast<double>(points.size()) /
+                    static_cast<double>(points.size() - 1),
+                sample.xx, 1e-6);
+    EXPECT_NEAR(std::sqrt(static_cast<double>(reference.xx + reference.yy)),
+                span.GetStandardDistance().GetValue(Distance::Type::kMeter),
+                1e-6);
+  }
+}
+
+TEST(GeometryAccumulators, PerThreadPartialsMerge) {
+  constexpr std::size_t kThreadCount = 4U;
+  const auto points{MakeRandomPoints(kPointCount * 4, 500.0)};
+  std::vector<CentroidAccumulator> centroids(kThreadCount);
+  std::vector<BoundingBoxAccumulator> boxes(kThreadCount);
+  std::vector<DistanceRangeAccumulator> ranges(
+      kThreadCount, DistanceRangeAccumulator(Point2D(0.0, 0.0)));
+  std::vector<CovarianceAccumulator> covariances(kThreadCount);
+  std::vector<std::thread> threads;
+  const std::size_t chunk{points.size() / kThreadCount};
+  for (std::size_t thread = 0; thread < kThreadCount; ++thread) {
+    threads.emplace_back([&, thread] {
+      const Point2D* begin{points.data() + (thread * chunk)};
+      centroids[thread].Add(begin, chunk);
+      boxes[thread].Add(begin, chunk);
+      ranges[thread].Add(begin, chunk);
+      covariances[thread].Add(begin, chunk);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (std::size_t thread = 1; thread < kThreadCount; ++thread) {
+    centroids[0].Merge(centroids[thread]);
+    boxes[0].Merge(boxes[thread]);
+    ranges[0].Merge(ranges[thread]);
+    covariances[0].Merge(covariances[thread]);
+  }
+
+  CentroidAccumulator centroid;
+  BoundingBoxAccumulator box;
+  DistanceRangeAccumulator range(Point2D(0.0, 0.0));
+  CovarianceAccumulator covariance;
+  centroid.Add(points);
+  box.Add(points);
+  range.Add(points);
+  covariance.Add(points);
+  EXPECT_EQ(points.size(), centroids[0].GetCount());
+  EXPECT_NEAR(centroid.GetCentroid().GetX(), centroids[0].GetCentroid().GetX(),
+              1e-9);
+  EXPECT_EQ(box.GetMinCorner(), boxes[0].GetMinCorner());
+  EXPECT_EQ(box.GetMaxCorner(), boxes[0].GetMaxCorner());
+  EXPECT_EQ(range.GetMin(), ranges[0].GetMin());
+  EXPECT_EQ(range.GetMax(), ranges[0].GetMax());
+  EXPECT_NEAR(covariance.GetCovariance().xy,
+              covariances[0].GetCovariance().xy, 1e-9);
+}
+
+TEST(GeometryAccumulators, StatesRoundTrip) {
+  const auto points{MakeRandomPoints(100, 0.0)};
+  CovarianceAccumulator first;
+  first.Add(points.data(), 50);
+  CovarianceAccumulator second;
+  second.Add(points.data() + 50, 50);
+
+  // A partial shipped as its plain state merges like the original.
+  CovarianceAccumulator shipped(second.GetState());
+  first.Merge(shipped);
+  CovarianceAccumulator whole;
+  whole.Add(points);
+  EXPECT_EQ(whole.GetCount(), first.GetCount());
+  EXPECT_NEAR(whole.GetCovariance().yy, first.GetCovariance().yy, 1e-9);
+
+  CentroidAccumulator centroid;
+  centroid.Add(points);
+  EXPECT_EQ(centroid.GetCentroid(),
+            CentroidAccumulator(centroid.GetState()).GetCentroid());
+}
+
+TEST(GeometryAccumulators, InvalidState) {
+  EXPECT_THROW(static_cast<void>(CentroidAccumulator().GetCentroid()),
+               std::logic_error);
+  EXPECT_THROW(static_cast<void>(BoundingBoxAccumulator().GetMinCorner()),
+               std::logic_error);
+  DistanceRangeAccumulator range(Point2D(0.0, 0.0));
+  EXPECT_THROW(static_cast<void>(range.GetMax()), std::logic_error);
+  EXPECT_THROW(range.Merge(DistanceRangeAccumulator(Point2D(1.0, 0.0))),
+               std::invalid_argument);
+  CovarianceAccumulator covariance;
+  covariance.Add(Point2D(1.0, 1.0));
+  EXPECT_NO_THROW(static_cast<void>(covariance.GetCovariance()));
+  EXPECT_THROW(static_cast<void>(covariance.GetSampleCovariance()),
+               std::logic_error);
+}
+
+}  // namespace geometry
@@ -0,0 +1,108 @@
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/approximate_distance.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr std::size_t kPointCount = 200000U;
+
+constexpr std::array<geometry::DistanceApproximation, 4> kApproximations{
+    geometry::DistanceApproximation::kExact,
+    geometry::DistanceApproximation::kNewtonRsqrt,
+    geometry::DistanceApproximation::kOctagonal,
+    geometry::DistanceApproximation::kFloat32};
+
+// Points in every direction at scales from micrometers to thousands of
+// kilometers around an origin away from zero.
+auto MakePoints(std::size_t count) -> std::vector<geometry::Point2D> {
+  std::mt19937 random(7);
+  std::uniform_real_distribution<double> angle(0.0, 2.0 * M_PI);
+  std::uniform_real_distribution<double> exponent(-6.0, 7.0);
+  std::vector<geometry::Point2D> points;
+  for (std::size_t i = 0; i < count; ++i) {
+    const double theta{angle(random)};
+    const double radius{std::pow(10.0, exponent(random))};
+    points.emplace_back(1000.0 + (radius * std::cos(theta)),
+                        -500.0 + (radius * std::sin(theta)));
+  }
+  return points;
+}
+
+auto MeasureError(const std::vector<geometry::Point2D>& points,
+                  const geometry::Point2D& origin,
+                  geometry::DistanceApproximation approximation) -> double {
+  const auto distances{
+      geometry::ApproximateDistances(origin, points, approximation)};
+  double error{0.0};
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    const double exact{origin.CalculateDistance(points[i])};
+    error = std::max(error, std::abs(distances[i] - exact) / exact);
+  }
+  return error;
+}
+}  // namespace
+
+namespace geometry {
+
+TEST(GeometryApproximateDistance, ErrorWithinDocumentedBound) {
+  const auto points{MakePoints(kPointCount)};
+  const Point2D origin(1000.0, -500.0);
+  for (const auto approximation : kApproximations) {
+    const double bound{GetMaxRelativeError(approximation)};
+    const double error{MeasureError(points, origin, approximation)};
+    // The exact norm may differ from CalculateDistance in the last bit.
+    EXPECT_LE(error, bound + 1e-15) << static_cast<int>(approximation);
+    // The bounds are tight, not just safe.
+    EXPECT_GE(error, bound / 4.0) << static_cast<int>(approximation);
+    if (approximation == DistanceApproximation::kExact) {
+      EXPECT_GT(1e-15, error);
+    }
+  }
+}
+
+TEST(GeometryApproximateDistance, PolicyMatchesRuntimeMode) {
+  const auto points{MakePoints(1000)};
+  const Point2D origin(3.0, 4.0);
+  std::vector<double> xs;
+  std::vector<double> ys;
+  for (const auto& point : points) {
+    xs.push_back(point.GetX());
+    ys.push_back(point.GetY());
+  }
+  std::vector<double> policy(points.size());
+  ApproximateDistances<OctagonalNorm>(origin, points.data(), points.size(),
+                                      policy.data());
+  std::vector<double> arrays(points.size());
+  ApproximateDistances(origin, xs.data(), ys.data(), xs.size(), arrays.data(),
+                       DistanceApproximation::kOctagonal);
+  EXPECT_EQ(policy, arrays);
+  EXPECT_EQ(policy,
+            ApproximateDistances(origin, points,
+                                 DistanceApproximation::kOctagonal));
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    EXPECT_EQ(ApproximateDistance<NewtonRsqrtNorm>(origin, points[i]),
+              ApproximateDistance(origin, points[i],
+                                  DistanceApproximation::kNewtonRsqrt));
+    EXPECT_DOUBLE_EQ(origin.CalculateDistance(points[i]),
+                     ApproximateDistance<ExactNorm>(origin, points[i]));
+  }
+}
+
+TEST(GeometryApproximateDistance, ZeroDistance) {
+  const Point2D point(12.5, -3.0);
+  for (const auto approximation : kApproximations) {
+    EXPECT_EQ(0.0, ApproximateDistance(point, point, approximation));
+  }
+  EXPECT_EQ(5.0, ApproximateDistance(Point2D(0.0, 0.0), Point2D(3.0, 4.0),
+                                     DistanceApproximation::kFloat32));
+}
+
+}  // namespace geometry
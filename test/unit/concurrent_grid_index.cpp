@@ -0,0 +1,302 @@
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/concurrent_grid_index.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 200U;
+constexpr std::size_t kCapacity = 2000U;
+constexpr double kExtent = 1000.0;
+
+auto MakeIndex() -> geometry::ConcurrentGridIndex {
+  return geometry::ConcurrentGridIndex(geometry::Point2D(0.0, 0.0),
+                                       geometry::Point2D(kExtent, kExtent),
+                                       geometry::Distance(50.0), kCapacity);
+}
+
+auto RandomCoordinate() -> double {
+  return static_cast<double>(std::rand()) / RAND_MAX * kExtent;
+}
+
+auto Query(const geometry::ConcurrentGridIndex& index,
+           const geometry::Point2D& center, double radius)
+    -> std::vector<uint32_t> {
+  std::vector<uint32_t> ids;
+  index.ForEachInRadius(center, geometry::Distance(radius),
+                        [&ids](uint32_t id, double) { ids.push_back(id); });
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+auto BruteForce(const std::vector<geometry::Point2D>& positions,
+                const std::vector<bool>& present,
+                const geometry::Point2D& center, double radius)
+    -> std::vector<uint32_t> {
+  std::vector<uint32_t> ids;
+  for (uint32_t id = 0; id < positions.size(); ++id) {
+    if (present[id] && positions[id].CalculateDistance(center) <= radius) {
+      ids.push_back(id);
+    }
+  }
+  return ids;
+}
+}  // namespace
+
+namespace geometry {
+
+TEST(GeometryConcurrentGridIndex, QueriesMatchBruteForce) {
+  auto index{MakeIndex()};
+  std::vector<Point2D> positions(kCapacity);
+  std::vector<bool> present(kCapacity, false);
+  std::vector<PositionUpdate> updates;
+  for (uint32_t id = 0; id < kCapacity; id += 2) {
+    positions[id] = Point2D(RandomCoordinate(), RandomCoordinate());
+    present[id] = true;
+    updates.push_back({id, positions[id]});
+  }
+  index.Update(updates);
+  EXPECT_EQ(kCapacity / 2, index.GetSize());
+
+  for (uint32_t test = 0; test < kTestCount; ++test) {
+    // Move some objects, remove some others and check a random query.
+    updates.clear();
+    std::vector<uint32_t> removed;
+    for (int i = 0; i < 20; ++i) {
+      const auto id{static_cast<uint32_t>(std::rand() % kCapacity)};
+      if (i % 4 == 0) {
+        removed.push_back(id);
+        present[id] = false;
+      } else {
+        positions[id] = Point2D(RandomCoordinate() * 1.2 - 100.0,
+                                RandomCoordinate() * 1.2 - 100.0);
+        updates.push_back({id, positions[id]});
+      }
+    }
+    index.Remove(removed);
+    index.Update(updates);
+    for (const auto& update : updates) {
+      present[update.id] = true;
+    }
+    const Point2D center(RandomCoordinate(), RandomCoordinate());
+    const double radius{RandomCoordinate() / 5.0};
+    EXPECT_EQ(BruteForce(positions, present, center, radius),
+              Query(index, center, radius));
+  }
+  EXPECT_EQ(static_cast<std::size_t>(
+                std::count(present.begin(), present.end(), true)),
+            index.GetSize());
+}
+
+TEST(GeometryConcurrentGridIndex, LaterUpdateInBatchWins) {
+  auto index{MakeIndex()};
+  index.Update({{7, Point2D(10.0, 10.0)}, {7, Point2D(900.0, 900.0)}});
+  EXPECT_EQ(1U, index.GetSize());
+  EXPECT_TRUE(Query(index, Point2D(10.0, 10.0), 5.0).empty());
+  EXPECT_EQ(std::vector<uint32_t>{7}, Query(index, Point2D(900.0, 900.0), 5.0));
+  index.Remove({7, 8});
+  EXPECT_EQ(0U, index.GetSize());
+}
+
+TEST(GeometryConcurrentGridIndex, CellVersionsAdvance) {
+  auto index{MakeIndex()};
+  EXPECT_EQ(20U, index.GetColumnCount());
+  EXPECT_EQ(20U, index.GetRowCount());
+  EXPECT_EQ(0U, index.GetCellVersion(0, 0));
+  index.Update({{1, Point2D(10.0, 10.0)}, {2, Point2D(20.0, 20.0)}});
+  EXPECT_EQ(1U, index.GetCellVersion(0, 0));
+  index.Update({{1, Point2D(60.0, 10.0)}});
+  EXPECT_EQ(2U, index.GetCellVersion(0, 0));
+  EXPECT_EQ(1U, index.GetCellVersion(1, 0));
+  EXPECT_EQ(0U, index.GetCellVersion(2, 0));
+}
+
+TEST(GeometryConcurrentGridIndex, ReadersBeyondSlotsShareOne) {
+  auto index{MakeIndex()};
+  index.Update({{1, Point2D(10.0, 10.0)}, {2, Point2D(15.0, 10.0)}});
+  // Nested queries take every reader slot, then a query on another thread
+  // joins the shared slot and stays inside its scan while all the others
+  // leave and the objects move away twice.
+  std::atomic<int> stage{0};
+  std::size_t shared_visits{0};
+  std::thread shared_reader;
+  std::function<void(std::size_t)> nest{[&](std::size_t depth) {
+    bool nested{false};
+    index.ForEachInRadius(Point2D(10.0, 10.0), Distance(20.0),
+                          [&](uint32_t, double) {
+                            if (nested) {
+                              return;
+                            }
+                            nested = true;
+                            if (depth < 1024) {
+                              nest(depth + 1);
+                              return;
+                            }
+                            shared_reader = std::thread([&] {
+                              index.ForEachInRadius(
+                                  Point2D(10.0, 10.0), Distance(20.0),
+                                  [&](uint32_t, double) {
+                                    ++shared_visits;
+                                    if (stage.exchange(1) != 0) {
+                                      return;
+                                    }
+                                    while (stage.load() != 2) {
+                                      std::this_thread::yield();
+                                    }
+                                  });
+                            });
+                            while (stage.load() != 1) {
+                              std::this_thread::yield();
+                            }
+                          });
+  }};
+  nest(0);
+  index.Update({{1, Point2D(500.0, 500.0)}, {2, Point2D(600.0, 600.0)}});
+  index.Update({{1, Point2D(12.0, 10.0)}});
+  stage.store(2);
+  shared_reader.join();
+  // The shared reader still scanned the snapshot it loaded before the moves.
+  EXPECT_EQ(2U, shared_visits);
+  EXPECT_EQ(std::vector<uint32_t>{1}, Query(index, Point2D(10.0, 10.0), 5.0));
+}
+
+TEST(GeometryConcurrentGridIndex, ConcurrentStress) {
+  constexpr uint32_t kStaticCount = 1000U;
+  constexpr std::size_t kWriterCount = 2U;
+  constexpr std::size_t kReaderCount = 4U;
+  constexpr int kBatchCount = 300;
+  constexpr double kRadius = 120.0;
+  auto index{MakeIndex()};
+
+  // Static objects never move, so every query must report each of them in
+  // range exactly once however the moving objects are republished.
+  std::vector<Point2D> statics;
+  std::vector<PositionUpdate> updates;
+  for (uint32_t id = 0; id < kStaticCount; ++id) {
+    statics.emplace_back(RandomCoordinate(), RandomCoordinate());
+    updates.push_back({id, statics.back()});
+  }
+  index.Update(updates);
+
+  std::atomic<bool> done{false};
+  std::atomic<std::size_t> failures{0};
+  std::atomic<std::size_t> queries{0};
+  std::vector<std::thread> threads;
+  for (std::size_t reader = 0; reader < kReaderCount; ++reader) {
+    threads.emplace_back([&, reader] {
+      std::mt19937 random(static_cast<uint32_t>(reader));
+      std::uniform_real_distribution<double> coordinate(0.0, kExtent);
+      do {
+        const Point2D center(coordinate(random), coordinate(random));
+        std::vector<uint32_t> seen;
+        index.ForEachInRadius(center, Distance(kRadius),
+                              [&](uint32_t id, double squared) {
+                                if (squared > kRadius * kRadius ||
+                                    id >= kCapacity) {
+                                  failures.fetch_add(1);
+                                }
+                                if (id < kStaticCount) {
+                                  seen.push_back(id);
+                                }
+                              });
+        std::sort(seen.begin(), seen.end());
+        std::vector<uint32_t> expected;
+        for (uint32_t id = 0; id < kStaticCount; ++id) {
+          if (statics[id].CalculateDistance(center) <= kRadius) {
+            expected.push_back(id);
+          }
+        }
+        if (seen != expected) {
+          failures.fetch_add(1);
+        }
+        queries.fetch_add(1);
+      } while (!done.load());
+    });
+  }
+
+  std::vector<std::vector<Point2D>> finals(kWriterCount);
+  std::vector<std::thread> writers;
+  for (std::size_t writer = 0; writer < kWriterCount; ++writer) {
+    writers.emplace_back([&, writer] {
+      std::mt19937 random(static_cast<uint32_t>(100 + writer));
+      std::uniform_real_distribution<double> coordinate(-50.0, kExtent + 50.0);
+      const auto first{static_cast<uint32_t>(
+          kStaticCount + (writer * (kCapacity - kStaticCount) / kWriterCount))};
+      const auto count{static_cast<uint32_t>((kCapacity - kStaticCount) /
+                                             kWriterCount)};
+      auto& positions{finals[writer]};
+      positions.assign(count, Point2D());
+      for (int batch = 0; batch < kBatchCount; ++batch) {
+        std::vector<PositionUpdate> moves;
+        for (uint32_t i = 0; i < count; i += 1 + (random() % 8)) {
+          positions[i] = Point2D(coordinate(random), coordinate(random));
+          moves.push_back({first + i, positions[i]});
+        }
+        index.Update(moves);
+        if (batch + 1 < kBatchCount && batch % 10 == 0) {
+          index.Remove({first, first + 1});
+          index.Update({{first, positions[0]}, {first + 1, positions[1]}});
+        }
+      }
+    });
+  }
+  for (auto& writer : writers) {
+    writer.join();
+  }
+  done.store(true);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(0U, failures.load());
+  EXPECT_LT(0U, queries.load());
+
+  // After the writers finished, the index holds their last positions.
+  std::vector<Point2D> positions(statics);
+  for (const auto& final_positions : finals) {
+    positions.insert(positions.end(), final_positions.begin(),
+                     final_positions.end());
+  }
+  const std::vector<bool> present(kCapacity, true);
+  EXPECT_EQ(kCapacity, index.GetSize());
+  for (uint32_t test = 0; test < kTestCount; ++test) {
+    const Point2D center(RandomCoordinate(), RandomCoordinate());
+    EXPECT_EQ(BruteForce(positions, present, center, kRadius),
+              Query(index, center, kRadius));
+  }
+}
+
+TEST(GeometryConcurrentGridIndex, InvalidInput) {
+  const Point2D origin(0.0, 0.0);
+  const Point2D corner(100.0, 100.0);
+  EXPECT_THROW(ConcurrentGridIndex(origin, corner, Distance(0.0), 10),
+               std::invalid_argument);
+  EXPECT_THROW(ConcurrentGridIndex(corner, origin, Distance(1.0), 10),
+               std::invalid_argument);
+  EXPECT_THROW(
+      ConcurrentGridIndex(origin, Point2D(1e9, 1e9), Distance(1.0), 10),
+      std::invalid_argument);
+  auto index{MakeIndex()};
+  EXPECT_THROW(index.Update({{0, Point2D(1.0, 1.0)},
+                             {static_cast<uint32_t>(kCapacity), origin}}),
+               std::invalid_argument);
+  EXPECT_EQ(0U, index.GetSize());
+  EXPECT_THROW(
+      index.Update(
+          {{0, Point2D(std::numeric_limits<double>::infinity(), 1.0)}}),
+      std::invalid_argument);
+  EXPECT_THROW(index.Remove({static_cast<uint32_t>(kCapacity)}),
+               std::invalid_argument);
+}
+
+}  // namespace geometry
@@ -0,0 +1,136 @@
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/cpu_dispatch.hpp"
+
+#include <cstdlib>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "geometry/approximate_distance.hpp"
+#include "geometry/predicates.hpp"
+#include "geometry/space_filling_curve.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+constexpr std::size_t kPointCount = 5000U;
+
+auto MakePoints() -> std::vector<geometry::Point2D> {
+  std::mt19937_64 random(7);
+  std::uniform_real_distribution<double> coordinate(-1000.0, 1000.0);
+  std::vector<geometry::Point2D> points;
+  for (std::size_t i = 0; i < kPointCount; ++i) {
+    points.emplace_back(coordinate(random), coordinate(random));
+  }
+  // Cocircular and collinear points take the adaptive stages.
+  points.emplace_back(0.0, 10.0);
+  points.emplace_back(20.0, 0.0);
+  return points;
+}
+
+// Results of every batch kernel on the bound kernel path.
+struct KernelResults {
+  std::vector<std::vector<double>> distances;
+  std::vector<std::vector<uint64_t>> keys;
+  std::vector<uint64_t> mortons;
+  std::vector<double> orientations;
+  std::vector<double> circles;
+};
+
+auto RunKernels(const std::vector<geometry::Point2D>& points)
+    -> KernelResults {
+  const geometry::Point2D origin(3.0, -4.0);
+  KernelResults results;
+  for (const auto approximation :
+       {geometry::DistanceApproximation::kExact,
+        geometry::DistanceApproximation::kNewtonRsqrt,
+        geometry::DistanceApproximation::kOctagonal,
+        geometry::DistanceApproximation::kFloat32}) {
+    results.distances.push_back(
+        geometry::ApproximateDistances(origin, points, approximation));
+  }
+  for (const auto curve : {geometry::SpaceFillingCurve::kMorton,
+                           geometry::SpaceFillingCurve::kHilbert}) {
+    std::vector<uint64_t> keys(points.size());
+    geometry::ComputeCurveKeys(points.data(), points.size(),
+                               geometry::Point2D(-1000.0, -1000.0),
+                               geometry::Point2D(1000.0, 1000.0), curve,
+                               keys.data());
+    results.keys.push_back(keys);
+  }
+  std::mt19937 random(8);
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    const auto x{static_cast<uint32_t>(random())};
+    const auto y{static_cast<uint32_t>(random())};
+    results.mortons.push_back(geometry::EncodeMorton(x, y));
+  }
+  const geometry::Point2D a(-10.0, 0.0);
+  const geometry::Point2D b(10.0, 0.0);
+  const geometry::Point2D c(0.0, 10.0);
+  results.orientations = geometry::Orient2D(a, b, points);
+  results.circles = geometry::InCircle(a, b, c, points);
+  return results;
+}
+}  // namespace
+
+namespace geometry {
+
+// Runs first, before any kernel binds a path.
+TEST(GeometryCpuDispatch, ForcedPath) {
+#if !defined(_WIN32)
+  ASSERT_EQ(0, setenv(kKernelPathVariable.data(), "scalar", 1));
+  const auto paths{GetAvailableKernelPaths()};
+  ASSERT_FALSE(paths.empty());
+  EXPECT_EQ(paths.front(), GetKernelPath());
+  SetKernelPath(paths.back());
+  EXPECT_EQ(paths.back(), GetKernelPath());
+#endif
+}
+
+TEST(GeometryCpuDispatch, Names) {
+  for (const auto path : {KernelPath::kScalar, KernelPath::kNeon,
+                          KernelPath::kAvx2, KernelPath::kAvx512}) {
+    KernelPath parsed{KernelPath::kScalar};
+    ASSERT_TRUE(ParseKernelPath(GetKernelPathName(path), parsed));
+    EXPECT_EQ(path, parsed);
+  }
+  KernelPath unchanged{KernelPath::kAvx2};
+  EXPECT_FALSE(ParseKernelPath("sse2", unchanged));
+  EXPECT_EQ(KernelPath::kAvx2, unchanged);
+  EXPECT_THROW(static_cast<void>(GetKernelPathName(static_cast<KernelPath>(9))),
+               std::invalid_argument);
+}
+
+TEST(GeometryCpuDispatch, Available) {
+  const auto paths{GetAvailableKernelPaths()};
+  ASSERT_FALSE(paths.empty());
+#if defined(__aarch64__)
+  EXPECT_EQ(KernelPath::kNeon, paths.front());
+  EXPECT_THROW(SetKernelPath(KernelPath::kAvx2), std::invalid_argument);
+#else
+  EXPECT_EQ(KernelPath::kScalar, paths.front());
+  EXPECT_THROW(SetKernelPath(KernelPath::kNeon), std::invalid_argument);
+#endif
+}
+
+TEST(GeometryCpuDispatch, PathsAgree) {
+  const auto points{MakePoints()};
+  const auto paths{GetAvailableKernelPaths()};
+  SetKernelPath(paths.front());
+  const auto expected{RunKernels(points)};
+  for (const auto path : paths) {
+    SetKernelPath(path);
+    const auto results{RunKernels(points)};
+    EXPECT_EQ(expected.distances, results.distances)
+        << GetKernelPathName(path);
+    EXPECT_EQ(expected.keys, results.keys) << GetKernelPathName(path);
+    EXPECT_EQ(expected.mortons, results.mortons) << GetKernelPathName(path);
+    EXPECT_EQ(expected.orientations, results.orientations)
+        << GetKernelPathName(path);
+    EXPECT_EQ(expected.circles, results.circles) << GetKernelPathName(path);
+  }
+  SetKernelPath(paths.back());
+}
+
+}  // namespace geometry
@@ -0,0 +1,142 @@
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/dbscan.hpp"
+
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kPointCount = 1500U;
+
+auto MakeClusteredPoints(uint32_t count) -> std::vector<geometry::Point2D> {
+  std::vector<geometry::Point2D> points;
+  points.reserve(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    const auto center{static_cast<double>((i % 5) * 100)};
+    points.emplace_back(
+        center + (20.0 * static_cast<double>(std::rand()) / RAND_MAX),
+        center + (20.0 * static_cast<double>(std::rand()) / RAND_MAX));
+  }
+  for (uint32_t i = 0; i < count / 10; ++i) {
+    points.emplace_back(500.0 * static_cast<double>(std::rand()) / RAND_MAX,
+                        500.0 * static_cast<double>(std::rand()) / RAND_MAX);
+  }
+  return points;
+}
+}  // namespace
+
+namespace geometry {
+
+TEST(GeometryDbscan, SimpleClusters) {
+  const std::vector<Point2D> points{
+      Point2D(0.0, 0.0),  Point2D(0.5, 0.0),  Point2D(0.0, 0.5),
+      Point2D(10.0, 0.0), Point2D(10.5, 0.0), Point2D(10.0, 0.5),
+      Point2D(1.2, 0.0),  Point2D(50.0, 50.0)};
+  DbscanOptions options;
+  options.eps = Distance(1.0);
+  options.min_points = 3;
+  const auto result{Dbscan(points, options)};
+  EXPECT_EQ(2U, result.cluster_count);
+  const std::vector<int32_t> expected{0, 0, 0, 1, 1, 1, 0, DbscanResult::kNoise};
+  EXPECT_EQ(expected, result.labels);
+  EXPECT_EQ(1U, result.is_core[0]);
+  EXPECT_EQ(0U, result.is_core[6]);
+  EXPECT_EQ(0U, result.is_core[7]);
+}
+
+TEST(GeometryDbscan, MatchesBruteForce) {
+  const auto points{MakeClusteredPoints(kPointCount)};
+  const double eps{3.0};
+  const std::size_t min_points{5};
+
+  std::vector<std::vector<std::size_t>> neighbours(points.size());
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    for (std::size_t j = 0; j < points.size(); ++j) {
+      if (points[i].CalculateDistance(points[j]) <= eps) {
+        neighbours[i].push_back(j);
+      }
+    }
+  }
+
+  DbscanOptions options;
+  options.eps = Distance(eps);
+  options.min_points = min_points;
+  options.thread_count = 4;
+  const auto result{Dbscan(points, options)};
+  ASSERT_EQ(points.size(), result.labels.size());
+
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    const bool core{neighbours[i].size() >= min_points};
+    EXPECT_EQ(core ? 1U : 0U, result.is_core[i]);
+    bool has_core_neighbour{false};
+    for (const auto j : neighbours[i]) {
+      const bool other_core{neighbours[j].size() >= min_points};
+      has_core_neighbour = has_core_neighbour || other_core;
+      if (core && other_core) {
+        EXPECT_EQ(result.labels[i], result.labels[j]);
+      }
+    }
+    if (has_core_neighbour) {
+      EXPECT_NE(DbscanResult::kNoise, result.labels[i]);
+    } else {
+      EXPECT_EQ(DbscanResult::kNoise, result.labels[i]);
+    }
+  }
+
+  std::vector<int32_t> component(points.size(), DbscanResult::kNoise);
+  std::size_t component_count{0};
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    if (neighbours[i].size() < min_points ||
+        component[i] != DbscanResult::kNoise) {
+      continue;
+    }
+    std::vector<std::size_t> stack{i};
+    component[i] = static_cast<int32_t>(component_count);
+    while (!stack.empty()) {
+      const auto current{stack.back()};
+      stack.pop_back();
+      for (const auto j : neighbours[current]) {
+        if (neighbours[j].size() >= min_points &&
+            component[j] == DbscanResult::kNoise) {
+          component[j] = static_cast<int32_t>(component_count);
+          stack.push_back(j);
+        }
+      }
+    }
+    ++component_count;
+  }
+  EXPECT_EQ(component_count, result.cluster_count);
+  std::set<std::pair<int32_t, int32_t>> pairs;
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    if (component[i] != DbscanResult::kNoise) {
+      pairs.emplace(component[i], result.labels[i]);
+    }
+  }
+  EXPECT_EQ(component_count, pairs.size());
+}
+
+TEST(GeometryDbscan, IndependentOfThreadCount) {
+  const auto points{MakeClusteredPoints(kPointCount)};
+  DbscanOptions options;
+  options.eps = Distance(2.0);
+  options.thread_count = 1;
+  const auto serial{Dbscan(points, options)};
+  options.thread_count = 8;
+  const auto parallel{Dbscan(points, options)};
+  EXPECT_EQ(serial.labels, parallel.labels);
+  EXPECT_EQ(serial.cluster_count, parallel.cluster_count);
+}
+
+TEST(GeometryDbscan, InvalidInput) {
+  DbscanOptions options;
+  options.eps = Distance(0.0);
+  EXPECT_THROW(static_cast<void>(Dbscan({}, options)), std::invalid_argument);
+  options.eps = Distance(1.0);
+  EXPECT_TRUE(Dbscan({}, options).labels.empty());
+}
+
+}  // namespace geometry
@@ -0,0 +1,245 @@
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/delaunay.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 20U;
+constexpr std::size_t kPointCount = 300U;
+constexpr double kTolerance = 1e-9;
+
+auto MakeRandomPoints(std::size_t count) -> std::vector<geometry::Point2D> {
+  std::vector<geometry::Point2D> points;
+  for (std::size_t i = 0; i < count; ++i) {
+    points.emplace_back(static_cast<double>(std::rand()) / RAND_MAX * 1000.0,
+                        static_cast<double>(std::rand()) / RAND_MAX * 1000.0);
+  }
+  return points;
+}
+
+auto Orient(const geometry::Point2D& a, const geometry::Point2D& b,
+            const geometry::Point2D& c) -> double {
+  return ((b.GetX() - a.GetX()) * (c.GetY() - a.GetY())) -
+         ((b.GetY() - a.GetY()) * (c.GetX() - a.GetX()));
+}
+
+auto PolygonArea(const std::vector<geometry::Point2D>& polygon) -> double {
+  double area{0.0};
+  for (std::size_t i = 0; i < polygon.size(); ++i) {
+    const auto& from{polygon[i]};
+    const auto& to{polygon[(i + 1) % polygon.size()]};
+    area += (from.GetX() * to.GetY()) - (to.GetX() * from.GetY());
+  }
+  return 0.5 * area;
+}
+
+/**
+ * @brief Check orientation, twin symmetry, the empty circumcircle property
+ * and the Euler triangle count.
+ */
+auto ExpectDelaunay(const geometry::DelaunayTriangulation& triangulation,
+                    std::size_t vertex_count) -> void {
+  const auto& points{triangulation.GetPoints()};
+  const auto& triangles{triangulation.GetTriangles()};
+  const auto& half_edges{triangulation.GetHalfEdges()};
+  ASSERT_EQ(triangles.size(), half_edges.size());
+  for (std::size_t t = 0; t < triangulation.GetTriangleCount(); ++t) {
+    const auto& a{points[triangles[3 * t]]};
+    const auto& b{points[triangles[(3 * t) + 1]]};
+    const auto& c{points[triangles[(3 * t) + 2]]};
+    EXPECT_GT(Orient(a, b, c), 0.0);
+
+    // No vertex lies strictly inside the circumcircle.
+    const double bx{b.GetX() - a.GetX()};
+    const double by{b.GetY() - a.GetY()};
+    const double cx{c.GetX() - a.GetX()};
+    const double cy{c.GetY() - a.GetY()};
+    const double scale{0.5 / ((bx * cy) - (by * cx))};
+    const double ux{((cy * ((bx * bx) + (by * by))) -
+                     (by * ((cx * cx) + (cy * cy)))) *
+                    scale};
+    const double uy{((bx * ((cx * cx) + (cy * cy))) -
+                     (cx * ((bx * bx) + (by * by)))) *
+                    scale};
+    const geometry::Point2D center(a.GetX() + ux, a.GetY() + uy);
+    const double radius{center.CalculateDistance(a)};
+    for (const auto& point : points) {
+      EXPECT_GE(center.CalculateDistance(point), radius * (1.0 - kTolerance));
+    }
+  }
+  for (std::size_t edge = 0; edge < half_edges.size(); ++edge) {
+    const uint32_t twin{half_edges[edge]};
+    if (twin == geometry::DelaunayTriangulation::kInvalidIndex) {
+      continue;
+    }
+    EXPECT_EQ(edge, half_edges[twin]);
+    const std::size_t next{(edge % 3 == 2) ? edge - 2 : edge + 1};
+    const std::size_t twin_next{(twin % 3 == 2) ? twin - 2 : twin + 1};
+    EXPECT_EQ(triangles[edge], triangles[twin_next]);
+    EXPECT_EQ(triangles[next], triangles[twin]);
+  }
+  EXPECT_EQ(triangulation.GetTriangleCount(),
+            (2 * vertex_count) - 2 - triangulation.GetHull().size());
+}
+}  // namespace
+
+namespace geometry {
+
+TEST(GeometryDelaunay, RandomPointsAreDelaunay) {
+  for (uint32_t test = 0; test < kTestCount; ++test) {
+    const DelaunayTriangulation triangulation(MakeRandomPoints(kPointCount));
+    ExpectDelaunay(triangulation, kPointCount);
+  }
+}
+
+TEST(GeometryDelaunay, GridPointsAreTriangulated) {
+  constexpr int kSide = 20;
+  std::vector<Point2D> points;
+  for (int x = 0; x < kSide; ++x) {
+    for (int y = 0; y < kSide; ++y) {
+      points.emplace_back(x, y);
+    }
+  }
+  const DelaunayTriangulation triangulation(points);
+  EXPECT_EQ(4U * (kSide - 1), triangulation.GetHull().size());
+  ExpectDelaunay(triangulation, points.size());
+}
+
+TEST(GeometryDelaunay, HullIsCounterClockwise) {
+  const std::vector<Point2D> points{{0.0, 0.0}, {4.0, 0.0}, {4.0, 4.0},
+                                    {0.0, 4.0}, {2.0, 2.0}, {1.0, 3.0}};
+  const DelaunayTriangulation triangulation(points);
+  const auto& hull{triangulation.GetHull()};
+  ASSERT_EQ(4U, hull.size());
+  for (std::size_t i = 0; i < hull.size(); ++i) {
+    EXPECT_GT(Orient(points[hull[i]], points[hull[(i + 1) % 4]],
+                     points[hull[(i + 2) % 4]]),
+              0.0);
+  }
+  EXPECT_EQ(6U, triangulation.GetTriangleCount());
+}
+
+TEST(GeometryDelaunay, DuplicatesAreInsertedOnce) {
+  auto points{MakeRandomPoints(kPointCount)};
+  const std::vector<Point2D> copies(points.begin(), points.begin() + 50);
+  points.insert(points.end(), copies.begin(), copies.end());
+  const DelaunayTriangulation triangulation(points);
+  ExpectDelaunay(triangulation, kPointCount);
+  std::size_t isolated{0};
+  for (uint32_t vertex = 0; vertex < points.size(); ++vertex) {
+    isolated += triangulation.GetNeighbours(vertex).empty() ? 1 : 0;
+  }
+  EXPECT_EQ(copies.size(), isolated);
+}
+
+TEST(GeometryDelaunay, DegenerateInputHasNoTriangles) {
+  EXPECT_EQ(0U, DelaunayTriangulation(std::vector<Point2D>{})
+                    .GetTriangleCount());
+  EXPECT_EQ(0U, DelaunayTriangulation({{0.0, 0.0}, {1.0, 1.0}})
+                    .GetTriangleCount());
+  std::vector<Point2D> collinear;
+  for (int i = 0; i < 10; ++i) {
+    collinear.emplace_back(i, 2 * i);
+  }
+  const DelaunayTriangulation triangulation(collinear);
+  EXPECT_EQ(0U, triangulation.GetTriangleCount());
+  EXPECT_TRUE(triangulation.GetHull().empty());
+  EXPECT_TRUE(triangulation.ComputeVoronoi().vertices.empty());
+}
+
+TEST(GeometryDelaunay, NeighboursAreSymmetric) {
+  const DelaunayTriangulation triangulation(MakeRandomPoints(kPointCount));
+  for (uint32_t vertex = 0; vertex < kPointCount; ++vertex) {
+    const auto neighbours{triangulation.GetNeighbours(vertex)};
+    EXPECT_GE(neighbours.size(), 2U);
+    for (const uint32_t neighbour : neighbours) {
+      const auto back{triangulation.GetNeighbours(neighbour)};
+      EXPECT_NE(back.end(), std::find(back.begin(), back.end(), vertex));
+    }
+  }
+}
+
+TEST(GeometryDelaunay, VoronoiCellsSurroundTheirSites) {
+  const DelaunayTriangulation triangulation(MakeRandomPoints(kPointCount));
+  const auto& points{triangulation.GetPoints()};
+  const auto diagram{triangulation.ComputeVoronoi()};
+  ASSERT_EQ(triangulation.GetTriangleCount(), diagram.vertices.size());
+  ASSERT_EQ(kPointCount + 1, diagram.cell_offsets.size());
+  const auto& hull{triangulation.GetHull()};
+  for (uint32_t site = 0; site < kPointCount; ++site) {
+    const bool on_hull{std::find(hull.begin(), hull.end(), site) != hull.end()};
+    EXPECT_EQ(on_hull, diagram.is_unbounded[site] != 0);
+
+    // Every cell vertex is the circumcenter of a triangle around the site.
+    std::vector<Point2D> cell;
+    for (uint32_t i = diagram.cell_offsets[site];
+         i < diagram.cell_offsets[site + 1]; ++i) {
+      const uint32_t triangle{diagram.cell_vertices[i]};
+      const Point2D& vertex{diagram.vertices[triangle]};
+      const double radius{vertex.CalculateDistance(points[site])};
+      for (uint32_t corner = 0; corner < 3; ++corner) {
+        const auto& other{
+            points[triangulation.GetTriangles()[(3 * triangle) + corner]]};
+        EXPECT_NEAR(radius, vertex.CalculateDistance(other),
+                    1e-6 * (1.0 + radius));
+      }
+      cell.push_back(vertex);
+    }
+    if (!on_hull) {
+      EXPECT_GT(PolygonArea(cell), 0.0);
+    }
+  }
+}
+
+TEST(GeometryDelaunay, ClippedCellsTileTheBox) {
+  const DelaunayTriangulation triangulation(MakeRandomPoints(kPointCount));
+  const auto& points{triangulation.GetPoints()};
+  const Point2D min_corner(-100.0, -100.0);
+  const Point2D max_corner(1100.0, 1100.0);
+  double total{0.0};
+  for (uint32_t site = 0; site < kPointCount; ++site) {
+    const auto cell{
+        triangulation.ClipVoronoiCell(site, min_corner, max_corner)};
+    ASSERT_GE(cell.size(), 3U);
+    total += PolygonArea(cell);
+
+    // The cell centroid is closer to the site than to any other site.
+    double cx{0.0};
+    double cy{0.0};
+    for (const auto& vertex : cell) {
+      cx += vertex.GetX();
+      cy += vertex.GetY();
+    }
+    const Point2D centroid(cx / static_cast<double>(cell.size()),
+                           cy / static_cast<double>(cell.size()));
+    const double own{centroid.CalculateDistance(points[site])};
+    for (const auto& other : points) {
+      EXPECT_LE(own, centroid.CalculateDistance(other) + kTolerance);
+    }
+  }
+  EXPECT_NEAR(1200.0 * 1200.0, total, 1e-3);
+}
+
+TEST(GeometryDelaunay, InvalidInput) {
+  EXPECT_THROW(
+      DelaunayTriangulation(
+          {{0.0, 0.0}, {1.0, 0.0}, {std::numeric_limits<double>::quiet_NaN(),
+                                    1.0}}),
+      std::invalid_argument);
+  const DelaunayTriangulation triangulation(MakeRandomPoints(10));
+  EXPECT_TRUE(triangulation.GetNeighbours(10).empty());
+  EXPECT_TRUE(
+      triangulation.ClipVoronoiCell(10, Point2D(0.0, 0.0), Point2D(1.0, 1.0))
+          .empty());
+}
+
+}  // namespace geometry
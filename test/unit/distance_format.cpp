@@ -0,0 +1,155 @@
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/distance_format.hpp"
+
+#include <array>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 10000U;
+
+auto Parse(std::string_view text) -> geometry::Distance {
+  geometry::Distance distance;
+  const auto result{geometry::ParseDistance(
+      text.data(), text.data() + text.size(), distance)};
+  EXPECT_EQ(std::errc{}, result.ec) << text;
+  EXPECT_EQ(text.data() + text.size(), result.ptr) << text;
+  return distance;
+}
+
+auto Format(const geometry::Distance& distance, geometry::Distance::Type unit)
+    -> std::string {
+  std::array<char, 64> buffer{};
+  const auto result{geometry::FormatDistance(
+      buffer.data(), buffer.data() + buffer.size(), distance, unit)};
+  EXPECT_EQ(std::errc{}, result.ec);
+  return std::string(buffer.data(), result.ptr);
+}
+
+auto Fails(std::string_view text) -> bool {
+  geometry::Distance distance;
+  const auto result{geometry::ParseDistance(
+      text.data(), text.data() + text.size(), distance)};
+  return result.ec != std::errc{};
+}
+}  // namespace
+
+namespace geometry {
+
+TEST(GeometryDistanceFormat, ParsesEveryUnit) {
+  EXPECT_EQ(12500000000000, Parse("12.5km").GetNanometer());
+  EXPECT_EQ(300000000000, Parse("300 m").GetNanometer());
+  EXPECT_EQ(200000, Parse("0.2mm").GetNanometer());
+  EXPECT_EQ(-15000000, Parse("-1.5cm").GetNanometer());
+  EXPECT_EQ(7000, Parse("+7um").GetNanometer());
+  EXPECT_EQ(7500, Parse("7.5\xC2\xB5m").GetNanometer());
+  EXPECT_EQ(42, Parse("42nm").GetNanometer());
+  EXPECT_EQ(500000000, Parse(".5").GetNanometer());
+  EXPECT_EQ(3000000000, Parse("3.").GetNanometer());
+  EXPECT_EQ(1500000000000, Parse("1.5e3 m").GetNanometer());
+  EXPECT_EQ(2500, Parse("2.5E-6m").GetNanometer());
+  // Digits below the nanometer are rounded half away from zero.
+  EXPECT_EQ(2, Parse("1.5nm").GetNanometer());
+  EXPECT_EQ(123456790, Parse("0.1234567895m").GetNanometer());
+  EXPECT_EQ(-123456789, Parse("-0.1234567894m").GetNanometer());
+  EXPECT_EQ(Distance(0.57), Parse("0.57m"));
+}
+
+TEST(GeometryDistanceFormat, FormatsExactly) {
+  EXPECT_EQ("12.5km", Format(Parse("12.5km"), Distance::Type::kKilometer));
+  EXPECT_EQ("12500m", Format(Parse("12.5km"), Distance::Type::kMeter));
+  EXPECT_EQ("0.0002m", Format(Parse("0.2mm"), Distance::Type::kMeter));
+  EXPECT_EQ("-1.5cm", Format(Parse("-15mm"), Distance::Type::kCentimeter));
+  EXPECT_EQ("0.042um", Format(Parse("42nm"), Distance::Type::kMicrometer));
+  EXPECT_EQ("0nm", Format(Distance(), Distance::Type::kNanometer));
+  EXPECT_EQ("-9223372.036854775808km",
+            Format(Distance::FromNanometer(std::numeric_limits<int64_t>::min()),
+                   Distance::Type::kKilometer));
+
+  std::array<char, 6> small{};
+  const Distance distance{Parse("12.5km")};
+  const auto result{FormatDistance(small.data(), small.data() + small.size(),
+                                   distance, Distance::Type::kKilometer)};
+  EXPECT_EQ(std::errc{}, result.ec);
+  EXPECT_EQ(std::errc::value_too_large,
+            FormatDistance(small.data(), small.data() + 5, distance,
+                           Distance::Type::kKilometer)
+                .ec);
+  EXPECT_EQ(std::errc::value_too_large,
+            FormatDistance(small.data(), small.data() + small.size(),
+                           distance, Distance::Type::kCentimeter)
+                .ec);
+}
+
+TEST(GeometryDistanceFormat, RoundTripsThroughNanometers) {
+  const std::array<Distance::Type, 6> units{
+      Distance::Type::kKilometer,  Distance::Type::kMeter,
+      Distance::Type::kCentimeter, Distance::Type::kMillimeter,
+      Distance::Type::kMicrometer, Distance::Type::kNanometer};
+  for (uint32_t test = 0; test < kTestCount; ++test) {
+    int64_t nanometer{(static_cast<int64_t>(std::rand()) << 31) ^ std::rand()};
+    nanometer >>= test % 40;
+    if (test % 2 == 1) {
+      nanometer = -nanometer;
+    }
+    const Distance distance{Distance::FromNanometer(nanometer)};
+    const std::string text{Format(distance, units[test % units.size()])};
+    EXPECT_EQ(nanometer, Parse(text).GetNanometer()) << text;
+  }
+  const Distance largest{
+      Distance::FromNanometer(std::numeric_limits<int64_t>::max())};
+  EXPECT_EQ(largest, Parse(Format(largest, Distance::Type::kMeter)));
+  // The most negative distance has no positive counterpart.
+  const Distance smallest{
+      Distance::FromNanometer(std::numeric_limits<int64_t>::min())};
+  for (const auto unit : units) {
+    EXPECT_EQ(smallest, Parse(Format(smallest, unit)));
+  }
+  EXPECT_EQ(smallest, Parse("-9.223372036854775808e9m"));
+  EXPECT_TRUE(Fails("9223372036854775808nm"));
+  EXPECT_TRUE(Fails("-9223372036854775809nm"));
+  EXPECT_TRUE(Fails("-9223372036.8547758085m"));
+}
+
+TEST(GeometryDistanceFormat, ParsesColumns) {
+  const std::vector<std::string_view> texts{"1km", "2 m", "3cm", "4mm"};
+  std::vector<Distance> distances;
+  EXPECT_EQ(texts.size(), ParseDistances(texts, distances));
+  EXPECT_EQ(Distance(3.0, Distance::Type::kCentimeter), distances[2]);
+
+  // The index of the first malformed entry is reported.
+  const std::vector<std::string_view> malformed{"1km", "2 m", "3 m ", "4mm"};
+  EXPECT_EQ(2U, ParseDistances(malformed, distances));
+  EXPECT_EQ(Distance(2.0), distances[1]);
+}
+
+TEST(GeometryDistanceFormat, InvalidInput) {
+  EXPECT_TRUE(Fails(""));
+  EXPECT_TRUE(Fails("-"));
+  EXPECT_TRUE(Fails("."));
+  EXPECT_TRUE(Fails("km"));
+  EXPECT_TRUE(Fails("5 ft"));
+  EXPECT_TRUE(Fails("5 meters"));
+  EXPECT_TRUE(Fails("9300000km"));
+  EXPECT_TRUE(Fails("1e30m"));
+  EXPECT_TRUE(Fails("99999999999999999999nm"));
+
+  // Like std::from_chars, parsing stops after the distance.
+  Distance distance;
+  const std::string_view text{"5m, 6m"};
+  const auto result{
+      ParseDistance(text.data(), text.data() + text.size(), distance)};
+  EXPECT_EQ(std::errc{}, result.ec);
+  EXPECT_EQ(text.data() + 2, result.ptr);
+  EXPECT_TRUE(Fails("5e"));
+}
+
+}  // namespace geometry
@@ -0,0 +1,168 @@
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/distance_sort.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr std::size_t kDistanceCount = 300000U;
+
+// Full range nanometers, including both extremes, mixed with a narrow range
+// so that many distances are equal.
+auto MakeDistances(std::size_t count, uint32_t seed)
+    -> std::vector<geometry::Distance> {
+  std::mt19937_64 random(seed);
+  std::vector<geometry::Distance> distances;
+  distances.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    auto nanometer{static_cast<int64_t>(random())};
+    if (i % 2 == 0) {
+      nanometer %= 1000;
+    }
+    distances.push_back(geometry::Distance::FromNanometer(nanometer));
+  }
+  distances[0] = geometry::Distance::FromNanometer(
+      std::numeric_limits<int64_t>::min());
+  distances[1] = geometry::Distance::FromNanometer(
+      std::numeric_limits<int64_t>::max());
+  return distances;
+}
+
+auto StableOrder(const std::vector<geometry::Distance>& distances)
+    -> std::vector<uint32_t> {
+  std::vector<uint32_t> order(distances.size());
+  std::iota(order.begin(), order.end(), 0U);
+  std::stable_sort(order.begin(), order.end(),
+                   [&distances](uint32_t lhs, uint32_t rhs) {
+                     return distances[lhs] < distances[rhs];
+                   });
+  return order;
+}
+}  // namespace
+
+namespace geometry {
+
+TEST(GeometryDistanceSort, SortMatchesStableSort) {
+  const auto distances{MakeDistances(kDistanceCount, 1)};
+  const auto expected{StableOrder(distances)};
+  for (const std::size_t thread_count : {1U, 4U}) {
+    EXPECT_EQ(expected, ArgsortDistances(distances, thread_count));
+
+    auto sorted{distances};
+    std::vector<uint32_t> indices(sorted.size());
+    std::iota(indices.begin(), indices.end(), 0U);
+    SortDistances(sorted.data(), indices.data(), sorted.size(), thread_count);
+    EXPECT_EQ(expected, indices);
+    for (std::size_t i = 0; i < sorted.size(); ++i) {
+      ASSERT_EQ(distances[expected[i]], sorted[i]);
+    }
+  }
+  auto sorted{distances};
+  SortDistances(sorted);
+  EXPECT_TRUE(std::is_sorted(sorted.begin(), sorted.end()));
+  EXPECT_EQ(Distance::FromNanometer(std::numeric_limits<int64_t>::min()),
+            sorted.front());
+  EXPECT_EQ(Distance::FromNanometer(std::numeric_limits<int64_t>::max()),
+            sorted.back());
+}
+
+TEST(GeometryDistanceSort, SelectSmallest) {
+  const auto distances{MakeDistances(kDistanceCount, 2)};
+  const auto order{StableOrder(distances)};
+  for (const std::size_t k : {1U, 2U, 7U, 1000U, 150000U, 299999U}) {
+    const auto selected{SelectSmallestDistances(distances, k)};
+    const std::vector<uint32_t> expected(order.begin(),
+                                         order.begin() + static_cast<long>(k));
+    EXPECT_EQ(expected, selected) << k;
+  }
+  EXPECT_EQ(order, SelectSmallestDistances(distances, kDistanceCount * 2));
+  EXPECT_TRUE(SelectSmallestDistances(distances, 0).empty());
+
+  // Ties across the k-th distance keep the input order.
+  const std::vector<Distance> equal(100, Distance(1.0));
+  const auto selected{SelectSmallestDistances(equal, 10)};
+  std::vector<uint32_t> expected(10);
+  std::iota(expected.begin(), expected.end(), 0U);
+  EXPECT_EQ(expected, selected);
+}
+
+TEST(GeometryDistanceSort, Histogram) {
+  const auto distances{MakeDistances(kDistanceCount, 3)};
+  const std::vector<std::pair<int64_t, int64_t>> layouts{
+      {-500, 7}, {0, 1}, {-1000000000, 3}, {123, 999999937}};
+  for (const auto& [origin, width] : layouts) {
+    constexpr std::size_t kBinCount{300};
+    std::vector<uint64_t> expected(kBinCount, 0);
+    uint64_t underflow{0};
+    uint64_t overflow{0};
+    for (const auto& distance : distances) {
+      const int64_t nanometer{distance.GetNanometer()};
+      if (nanometer < origin) {
+        ++underflow;
+        continue;
+      }
+      const auto bin{(static_cast<uint64_t>(nanometer) -
+                      static_cast<uint64_t>(origin)) /
+                     static_cast<uint64_t>(width)};
+      if (bin >= kBinCount) {
+        ++overflow;
+      } else {
+        ++expected[bin];
+      }
+    }
+    // Thread counts far beyond the hardware are capped.
+    for (const std::size_t thread_count :
+         {std::size_t{1}, std::size_t{3},
+          std::numeric_limits<std::size_t>::max()}) {
+      const auto histogram{HistogramDistances(
+          distances, Distance::FromNanometer(origin),
+          Distance::FromNanometer(width), kBinCount, thread_count)};
+      EXPECT_EQ(expected, histogram.counts) << origin << " " << width;
+      EXPECT_EQ(underflow, histogram.underflow);
+      EXPECT_EQ(overflow, histogram.overflow);
+      EXPECT_EQ(Distance::FromNanometer(width), histogram.bin_width);
+    }
+  }
+
+  // Bin edges are inclusive below and exclusive above.
+  const std::vector<Distance> edges{Distance::FromNanometer(9),
+                                    Distance::FromNanometer(10),
+                                    Distance::FromNanometer(19),
+                                    Distance::FromNanometer(20),
+                                    Distance::FromNanometer(40)};
+  const auto histogram{HistogramDistances(edges, Distance::FromNanometer(10),
+                                          Distance::FromNanometer(10), 3)};
+  EXPECT_EQ((std::vector<uint64_t>{2, 1, 0}), histogram.counts);
+  EXPECT_EQ(1U, histogram.underflow);
+  EXPECT_EQ(1U, histogram.overflow);
+}
+
+TEST(GeometryDistanceSort, InvalidHistogram) {
+  const std::vector<Distance> distances(3, Distance(1.0));
+  EXPECT_THROW(static_cast<void>(HistogramDistances(
+                   distances, Distance(), Distance(), 10)),
+               std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(HistogramDistances(
+                   distances, Distance(), Distance(-1.0), 10)),
+               std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(HistogramDistances(
+                   distances, Distance(), Distance(1.0), 0)),
+               std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(HistogramDistances(
+                   distances, Distance(), Distance(1.0),
+                   std::numeric_limits<std::size_t>::max())),
+               std::invalid_argument);
+  const auto histogram{
+      HistogramDistances(nullptr, 0, Distance(), Distance(1.0), 4)};
+  EXPECT_EQ((std::vector<uint64_t>(4, 0)), histogram.counts);
+}
+
+}  // namespace geometry
@@ -0,0 +1,128 @@
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/grid_index.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 100U;
+constexpr uint32_t kPointCount = 2000U;
+
+auto MakeRandomPoints(uint32_t count) -> std::vector<geometry::Point2D> {
+  std::vector<geometry::Point2D> points;
+  points.reserve(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    points.emplace_back(static_cast<double>(std::rand() % 10000) / 10.0,
+                        static_cast<double>(std::rand() % 10000) / 10.0);
+  }
+  return points;
+}
+}  // namespace
+
+namespace geometry {
+
+TEST(GeometryGridIndex, Constructor) {
+  GridIndex grid1;
+  EXPECT_EQ(0U, grid1.GetSize());
+
+  GridIndex grid2(MakeRandomPoints(kPointCount));
+  EXPECT_EQ(kPointCount, grid2.GetSize());
+  EXPECT_GT(grid2.GetCellSize(), 0.0);
+
+  GridIndex grid3(MakeRandomPoints(kPointCount), Distance(50.0));
+  EXPECT_DOUBLE_EQ(50.0, grid3.GetCellSize());
+}
+
+TEST(GeometryGridIndex, InvalidInput) {
+  std::vector<Point2D> points{Point2D(0.0, 0.0),
+                              Point2D(std::numeric_limits<double>::quiet_NaN(),
+                                      0.0)};
+  EXPECT_THROW(GridIndex grid(points), std::invalid_argument);
+  EXPECT_THROW(GridIndex grid({}, Distance(-1.0)), std::invalid_argument);
+  // Finite coordinates whose extent overflows.
+  EXPECT_THROW(GridIndex grid({Point2D(-1e308, 0.0), Point2D(1e308, 0.0)}),
+               std::invalid_argument);
+  EXPECT_THROW(GridIndex grid({Point2D(0.0, 1e308), Point2D(0.0, -1e308)},
+                              Distance(1.0)),
+               std::invalid_argument);
+}
+
+TEST(GeometryGridIndex, HugeExtent) {
+  // The auto cell size overflows although the extent does not.
+  const std::vector<Point2D> points{Point2D(-8e307, -8e307),
+                                    Point2D(8e307, 8e307), Point2D(0.0, 0.0)};
+  GridIndex grid(points);
+  EXPECT_TRUE(std::isfinite(grid.GetCellSize()));
+  std::vector<uint32_t> found;
+  grid.ForEachInRadius(Point2D(1.0, 1.0), Distance(10.0),
+                       [&found](uint32_t index, double) {
+                         found.push_back(index);
+                       });
+  EXPECT_EQ(std::vector<uint32_t>{2}, found);
+}
+
+TEST(GeometryGridIndex, CellsPartitionPoints) {
+  const auto points{MakeRandomPoints(kPointCount)};
+  GridIndex grid(points);
+
+  std::vector<uint32_t> indices{grid.GetIndices()};
+  std::sort(indices.begin(), indices.end());
+  for (uint32_t i = 0; i < kPointCount; ++i) {
+    EXPECT_EQ(i, indices[i]);
+  }
+
+  for (std::size_t row = 0; row < grid.GetRowCount(); ++row) {
+    for (std::size_t column = 0; column < grid.GetColumnCount(); ++column) {
+      for (auto slot = grid.GetCellBegin(column, row);
+           slot < grid.GetCellEnd(column, row); ++slot) {
+        EXPECT_EQ(column, grid.GetColumn(grid.GetXs()[slot]));
+        EXPECT_EQ(row, grid.GetRow(grid.GetYs()[slot]));
+      }
+    }
+  }
+}
+
+TEST(GeometryGridIndex, ForEachInRadius) {
+  const auto points{MakeRandomPoints(kPointCount)};
+  GridIndex grid(points);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const Point2D center(static_cast<double>(std::rand() % 1000),
+                         static_cast<double>(std::rand() % 1000));
+    const Distance radius(static_cast<double>(std::rand() % 100));
+
+    std::vector<uint32_t> found;
+    grid.ForEachInRadius(center, radius,
+                         [&found](uint32_t index, double squared_distance) {
+                           found.push_back(index);
+                           EXPECT_GE(squared_distance, 0.0);
+                         });
+    std::sort(found.begin(), found.end());
+
+    std::vector<uint32_t> expected;
+    for (uint32_t j = 0; j < kPointCount; ++j) {
+      if (center.CalculateDistance(points[j]) <=
+          radius.GetValue(Distance::Type::kMeter)) {
+        expected.push_back(j);
+      }
+    }
+    EXPECT_EQ(expected, found);
+  }
+}
+
+TEST(GeometryGridIndex, DegenerateInput) {
+  std::vector<Point2D> points(kTestCount, Point2D(5.0, 5.0));
+  GridIndex grid(points);
+  uint32_t found{0};
+  grid.ForEachInRadius(Point2D(5.0, 5.0), Distance(0.0),
+                       [&found](uint32_t, double) { ++found; });
+  EXPECT_EQ(kTestCount, found);
+}
+
+}  // namespace geometry
@@ -0,0 +1,116 @@
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/instrumentation.hpp"
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/point2d.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+constexpr uint32_t kThreadCount = 4U;
+}  // namespace
+
+namespace geometry {
+namespace instrumentation {
+
+TEST(GeometryInstrumentation, ProbeName) {
+  EXPECT_STREQ("point2d.calculate_distance",
+               GetProbeName(Probe::kPointCalculateDistance));
+  EXPECT_STREQ("distance.division_by_zero",
+               GetProbeName(Probe::kDistanceDivisionByZero));
+  EXPECT_STREQ("unknown", GetProbeName(Probe::kCount));
+}
+
+TEST(GeometryInstrumentation, CountHotPaths) {
+  Reset();
+  const Point2D source(0.0, 0.0);
+  const Point2D target(3.0, 4.0);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    static_cast<void>(source.CalculateDistance(target));
+  }
+  static_cast<void>(source / 0.0);
+  const Distance distance(1.0, Distance::Type::kKilometer);
+  static_cast<void>(distance.GetValue(Distance::Type::kMeter));
+  EXPECT_THROW(static_cast<void>(distance / 0.0), std::invalid_argument);
+
+  const auto snapshot{TakeSnapshot()};
+  const uint64_t expected{kEnabled ? 1U : 0U};
+  EXPECT_EQ(expected * kTestCount,
+            snapshot.Get(Probe::kPointCalculateDistance).count);
+  EXPECT_EQ(expected, snapshot.Get(Probe::kPointDivisionByZero).count);
+  EXPECT_EQ(expected, snapshot.Get(Probe::kDistanceToNanometer).count);
+  EXPECT_EQ(expected, snapshot.Get(Probe::kDistanceFromNanometer).count);
+  EXPECT_EQ(expected, snapshot.Get(Probe::kDistanceDivisionByZero).count);
+}
+
+TEST(GeometryInstrumentation, MergeFinishedThreads) {
+  Reset();
+  std::vector<std::thread> threads;
+  for (uint32_t i = 0; i < kThreadCount; ++i) {
+    threads.emplace_back([] {
+      for (uint32_t j = 0; j < kTestCount; ++j) {
+        Count(Probe::kPointCalculateDistance);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  const auto snapshot{TakeSnapshot()};
+  EXPECT_EQ(kEnabled ? kThreadCount * kTestCount : 0U,
+            snapshot.Get(Probe::kPointCalculateDistance).count);
+}
+
+TEST(GeometryInstrumentation, Histogram) {
+  Reset();
+  Record(Probe::kPointCalculateDistance, 0);
+  Record(Probe::kPointCalculateDistance, 100);
+  Record(Probe::kPointCalculateDistance, 1000);
+
+  const auto probe{TakeSnapshot().Get(Probe::kPointCalculateDistance)};
+  if (kEnabled) {
+    EXPECT_EQ(3U, probe.samples);
+    EXPECT_EQ(1100U, probe.total_ns);
+    EXPECT_EQ(0U, probe.GetQuantile(0.0));
+    EXPECT_EQ(128U, probe.GetQuantile(0.5));
+    EXPECT_EQ(1024U, probe.GetQuantile(1.0));
+  } else {
+    EXPECT_EQ(0U, probe.samples);
+    EXPECT_EQ(0U, probe.GetQuantile(0.5));
+  }
+}
+
+TEST(GeometryInstrumentation, ScopedTimer) {
+  Reset();
+  { const ScopedTimer timer(Probe::kPointCalculateDistance); }
+  const auto snapshot{TakeSnapshot()};
+  EXPECT_EQ(kEnabled ? 1U : 0U,
+            snapshot.Get(Probe::kPointCalculateDistance).samples);
+}
+
+TEST(GeometryInstrumentation, Dump) {
+  Reset();
+  Count(Probe::kDistanceToNanometer);
+  const auto snapshot{TakeSnapshot()};
+  const auto text{snapshot.ToText()};
+  const auto json{snapshot.ToJson()};
+  EXPECT_NE(std::string::npos,
+            text.find(kEnabled ? "distance.to_nanometer count=1"
+                               : "distance.to_nanometer count=0"));
+  EXPECT_EQ('{', json.front());
+  EXPECT_EQ('}', json.back());
+  EXPECT_NE(std::string::npos, json.find("\"distance.to_nanometer\":{"));
+}
+
+TEST(GeometryInstrumentation, PerfMarkersDisable) {
+  EXPECT_FALSE(EnablePerfMarkers(false));
+}
+
+}  // namespace instrumentation
+}  // namespace geometry
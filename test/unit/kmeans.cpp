@@ -0,0 +1,150 @@
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/kmeans.hpp"
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kPointCount = 20000U;
+constexpr uint32_t kBlobCount = 4U;
+constexpr double kBlobSpacing = 1000.0;
+
+auto MakeBlobs(uint32_t count) -> std::vector<geometry::Point2D> {
+  std::vector<geometry::Point2D> points;
+  points.reserve(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    const auto blob{static_cast<double>(i % kBlobCount)};
+    points.emplace_back(
+        (blob * kBlobSpacing) + (50.0 * static_cast<double>(std::rand()) /
+                                 RAND_MAX),
+        (blob * kBlobSpacing) + (50.0 * static_cast<double>(std::rand()) /
+                                 RAND_MAX));
+  }
+  return points;
+}
+
+auto FindNearest(const std::vector<geometry::Point2D>& centroids,
+                 const geometry::Point2D& point) -> double {
+  double best{std::numeric_limits<double>::infinity()};
+  for (const auto& centroid : centroids) {
+    best = std::min(best, point.CalculateDistance(centroid));
+  }
+  return best;
+}
+}  // namespace
+
+namespace geometry {
+
+TEST(GeometryKMeans, SeparatedBlobs) {
+  const auto points{MakeBlobs(kPointCount)};
+  KMeansOptions options;
+  options.k = kBlobCount;
+  options.seed = 7;
+  const auto result{KMeans(points, options)};
+  ASSERT_EQ(kBlobCount, result.centroids.size());
+  ASSERT_EQ(points.size(), result.labels.size());
+  for (uint32_t blob = 0; blob < kBlobCount; ++blob) {
+    const Point2D center(blob * kBlobSpacing + 25.0,
+                         blob * kBlobSpacing + 25.0);
+    EXPECT_LT(FindNearest(result.centroids, center), 5.0);
+  }
+  for (uint32_t i = kBlobCount; i < kPointCount; ++i) {
+    EXPECT_EQ(result.labels[i % kBlobCount], result.labels[i]);
+  }
+}
+
+TEST(GeometryKMeans, ConvergesToLloydFixedPoint) {
+  std::vector<Point2D> points;
+  for (uint32_t i = 0; i < kPointCount; ++i) {
+    points.emplace_back(1000.0 * static_cast<double>(std::rand()) / RAND_MAX,
+                        1000.0 * static_cast<double>(std::rand()) / RAND_MAX);
+  }
+  KMeansOptions options;
+  options.k = 16;
+  options.max_iterations = 1000;
+  options.thread_count = 4;
+  const auto result{KMeans(points, options)};
+
+  std::vector<double> sum_x(options.k, 0.0);
+  std::vector<double> sum_y(options.k, 0.0);
+  std::vector<double> members(options.k, 0.0);
+  double inertia{0.0};
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    const auto label{result.labels[i]};
+    const double own{points[i].CalculateDistance(result.centroids[label])};
+    EXPECT_LE(own, FindNearest(result.centroids, points[i]) + 1.0e-9);
+    sum_x[label] += points[i].GetX();
+    sum_y[label] += points[i].GetY();
+    members[label] += 1.0;
+    inertia += own * own;
+  }
+  for (std::size_t j = 0; j < options.k; ++j) {
+    ASSERT_GT(members[j], 0.0);
+    EXPECT_NEAR(sum_x[j] / members[j], result.centroids[j].GetX(), 1.0e-6);
+    EXPECT_NEAR(sum_y[j] / members[j], result.centroids[j].GetY(), 1.0e-6);
+  }
+  EXPECT_NEAR(inertia, result.inertia, inertia * 1.0e-9);
+  EXPECT_LT(result.distance_evaluations,
+            result.iterations * points.size() * options.k / 2);
+}
+
+TEST(GeometryKMeans, Deterministic) {
+  const auto points{MakeBlobs(kPointCount)};
+  KMeansOptions options;
+  options.k = 6;
+  options.seed = 3;
+  options.thread_count = 3;
+  const auto first{KMeans(points, options)};
+  const auto second{KMeans(points, options)};
+  EXPECT_EQ(first.labels, second.labels);
+  EXPECT_EQ(first.centroids, second.centroids);
+}
+
+TEST(GeometryKMeans, InvalidInput) {
+  KMeansOptions options;
+  options.k = 0;
+  EXPECT_THROW(static_cast<void>(KMeans(MakeBlobs(10), options)),
+               std::invalid_argument);
+  options.k = 11;
+  EXPECT_THROW(static_cast<void>(KMeans(MakeBlobs(10), options)),
+               std::invalid_argument);
+  options.k = 0;
+  EXPECT_THROW(MiniBatchKMeans batch(options), std::invalid_argument);
+}
+
+TEST(GeometryMiniBatchKMeans, Update) {
+  KMeansOptions options;
+  options.k = kBlobCount;
+  options.seed = 11;
+  MiniBatchKMeans kmeans(options);
+  EXPECT_TRUE(kmeans.GetCentroids().empty());
+  EXPECT_THROW(static_cast<void>(kmeans.Predict(Point2D())), std::logic_error);
+  EXPECT_THROW(kmeans.Update(MakeBlobs(kBlobCount - 1)),
+               std::invalid_argument);
+
+  const auto points{MakeBlobs(kPointCount)};
+  constexpr std::size_t kBatchSize{500};
+  for (std::size_t begin = 0; begin < points.size(); begin += kBatchSize) {
+    kmeans.Update(points.data() + begin,
+                  std::min(kBatchSize, points.size() - begin));
+  }
+  const auto centroids{kmeans.GetCentroids()};
+  uint64_t total{0};
+  for (const auto count : kmeans.GetCounts()) {
+    total += count;
+  }
+  EXPECT_EQ(kPointCount, total);
+  for (uint32_t blob = 0; blob < kBlobCount; ++blob) {
+    const Point2D center(blob * kBlobSpacing + 25.0,
+                         blob * kBlobSpacing + 25.0);
+    EXPECT_LT(FindNearest(centroids, center), 5.0);
+    EXPECT_EQ(kmeans.Predict(points[blob]), kmeans.Predict(center));
+  }
+}
+
+}  // namespace geometry
@@ -0,0 +1,117 @@
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/knn_join.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kQueryCount = 500U;
+constexpr uint32_t kReferenceCount = 3000U;
+
+auto MakeRandomPoints(uint32_t count, double extent)
+    -> std::vector<geometry::Point2D> {
+  std::vector<geometry::Point2D> points;
+  points.reserve(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    points.emplace_back(
+        extent * static_cast<double>(std::rand()) / RAND_MAX,
+        extent * static_cast<double>(std::rand()) / RAND_MAX);
+  }
+  return points;
+}
+
+auto BruteForce(const geometry::Point2D& query,
+                const std::vector<geometry::Point2D>& references,
+                std::size_t k) -> std::vector<uint32_t> {
+  std::vector<std::pair<double, uint32_t>> candidates;
+  for (uint32_t i = 0; i < references.size(); ++i) {
+    candidates.emplace_back(query.CalculateDistance(references[i]), i);
+  }
+  std::sort(candidates.begin(), candidates.end());
+  std::vector<uint32_t> result;
+  for (std::size_t i = 0; i < std::min(k, candidates.size()); ++i) {
+    result.push_back(candidates[i].second);
+  }
+  return result;
+}
+}  // namespace
+
+namespace geometry {
+
+TEST(GeometryKnnJoin, MatchesBruteForce) {
+  const auto queries{MakeRandomPoints(kQueryCount, 1200.0)};
+  const auto references{MakeRandomPoints(kReferenceCount, 1000.0)};
+  for (std::size_t k : {1U, 8U, 20U}) {
+    KnnJoinOptions options;
+    options.k = k;
+    options.batch_size = 64;
+    options.thread_count = 4;
+    const auto result{KnnJoin(queries, references, options)};
+    ASSERT_EQ(k, result.k);
+    ASSERT_EQ(queries.size() * k, result.indices.size());
+    ASSERT_EQ(queries.size() * k, result.distances.size());
+    for (std::size_t query = 0; query < queries.size(); ++query) {
+      const auto expected{BruteForce(queries[query], references, k)};
+      for (std::size_t rank = 0; rank < k; ++rank) {
+        const auto index{result.indices[(query * k) + rank]};
+        EXPECT_EQ(expected[rank], index);
+        EXPECT_NEAR(queries[query].CalculateDistance(references[index]),
+                    result.distances[(query * k) + rank].GetValue(
+                        Distance::Type::kMeter),
+                    1.0e-6);
+      }
+    }
+  }
+}
+
+TEST(GeometryKnnJoin, ReuseIndex) {
+  const auto queries{MakeRandomPoints(kQueryCount, 1000.0)};
+  const auto references{MakeRandomPoints(kReferenceCount, 1000.0)};
+  const GridIndex index(references, Distance(5.0));
+  KnnJoinOptions options;
+  options.k = 3;
+  const auto from_index{KnnJoin(queries, index, options)};
+  const auto from_points{KnnJoin(queries, references, options)};
+  EXPECT_EQ(from_points.indices, from_index.indices);
+}
+
+TEST(GeometryKnnJoin, FewerReferencesThanK) {
+  const std::vector<Point2D> queries{Point2D(0.0, 0.0), Point2D(10.0, 0.0)};
+  const std::vector<Point2D> references{Point2D(1.0, 0.0), Point2D(3.0, 0.0)};
+  KnnJoinOptions options;
+  options.k = 3;
+  const auto result{KnnJoin(queries, references, options)};
+  EXPECT_EQ(0U, result.indices[0]);
+  EXPECT_EQ(1U, result.indices[1]);
+  EXPECT_EQ(KnnJoinResult::kInvalidIndex, result.indices[2]);
+  EXPECT_EQ(1U, result.indices[3]);
+  EXPECT_EQ(0U, result.indices[4]);
+  EXPECT_EQ(KnnJoinResult::kInvalidIndex, result.indices[5]);
+  EXPECT_EQ(Distance(7.0), result.distances[3]);
+}
+
+TEST(GeometryKnnJoin, EmptyInput) {
+  const auto points{MakeRandomPoints(kQueryCount, 1.0)};
+  EXPECT_TRUE(KnnJoin({}, points).indices.empty());
+  const auto result{KnnJoin(points, std::vector<Point2D>())};
+  EXPECT_EQ(kQueryCount, result.indices.size());
+  EXPECT_TRUE(std::all_of(result.indices.begin(), result.indices.end(),
+                          [](uint32_t index) {
+                            return index == KnnJoinResult::kInvalidIndex;
+                          }));
+}
+
+TEST(GeometryKnnJoin, InvalidK) {
+  KnnJoinOptions options;
+  options.k = 0;
+  EXPECT_THROW(static_cast<void>(KnnJoin({}, std::vector<Point2D>(), options)),
+               std::invalid_argument);
+}
+
+}  // namespace geometry
@@ -0,0 +1,124 @@
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/polyline_distance.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 200U;
+
+auto MakeRandomWalk(std::size_t count) -> std::vector<geometry::Point2D> {
+  std::vector<geometry::Point2D> points;
+  double x{0.0};
+  double y{0.0};
+  for (std::size_t i = 0; i < count; ++i) {
+    x += static_cast<double>(std::rand() % 200) / 10.0 - 10.0;
+    y += static_cast<double>(std::rand() % 200) / 10.0 - 10.0;
+    points.emplace_back(x, y);
+  }
+  return points;
+}
+
+auto BruteForceHausdorff(const std::vector<geometry::Point2D>& lhs,
+                         const std::vector<geometry::Point2D>& rhs) -> double {
+  auto directed{[](const auto& from, const auto& to) {
+    double result{0.0};
+    for (const auto& point : from) {
+      double nearest{std::numeric_limits<double>::infinity()};
+      for (const auto& other : to) {
+        nearest = std::min(nearest, point.CalculateDistance(other));
+      }
+      result = std::max(result, nearest);
+    }
+    return result;
+  }};
+  return std::max(directed(lhs, rhs), directed(rhs, lhs));
+}
+
+auto BruteForceFrechet(const std::vector<geometry::Point2D>& lhs,
+                       const std::vector<geometry::Point2D>& rhs) -> double {
+  std::vector<std::vector<double>> table(lhs.size(),
+                                         std::vector<double>(rhs.size()));
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    for (std::size_t j = 0; j < rhs.size(); ++j) {
+      const double own{lhs[i].CalculateDistance(rhs[j])};
+      if (i == 0 && j == 0) {
+        table[i][j] = own;
+      } else if (i == 0) {
+        table[i][j] = std::max(table[i][j - 1], own);
+      } else if (j == 0) {
+        table[i][j] = std::max(table[i - 1][j], own);
+      } else {
+        table[i][j] = std::max(
+            std::min({table[i - 1][j], table[i - 1][j - 1], table[i][j - 1]}),
+            own);
+      }
+    }
+  }
+  return table.back().back();
+}
+}  // namespace
+
+namespace geometry {
+
+TEST(GeometryPolylineDistance, Hausdorff) {
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto lhs{MakeRandomWalk(1 + std::rand() % 60)};
+    const auto rhs{MakeRandomWalk(1 + std::rand() % 60)};
+    const double expected{BruteForceHausdorff(lhs, rhs)};
+    EXPECT_NEAR(expected,
+                CalculateHausdorffDistance(lhs, rhs).GetValue(
+                    Distance::Type::kMeter),
+                1.0e-6);
+    EXPECT_TRUE(IsHausdorffDistanceWithin(lhs, rhs, Distance(expected + 1e-6)));
+    EXPECT_FALSE(
+        IsHausdorffDistanceWithin(lhs, rhs, Distance(expected - 1e-6)));
+  }
+}
+
+TEST(GeometryPolylineDistance, DiscreteFrechet) {
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto lhs{MakeRandomWalk(1 + std::rand() % 60)};
+    const auto rhs{MakeRandomWalk(1 + std::rand() % 60)};
+    const double expected{BruteForceFrechet(lhs, rhs)};
+    EXPECT_NEAR(expected,
+                CalculateDiscreteFrechetDistance(lhs, rhs).GetValue(
+                    Distance::Type::kMeter),
+                1.0e-6);
+    EXPECT_TRUE(
+        IsDiscreteFrechetDistanceWithin(lhs, rhs, Distance(expected + 1e-6)));
+    EXPECT_FALSE(
+        IsDiscreteFrechetDistanceWithin(lhs, rhs, Distance(expected - 1e-6)));
+  }
+}
+
+TEST(GeometryPolylineDistance, FrechetAtLeastHausdorff) {
+  const auto lhs{MakeRandomWalk(100)};
+  auto rhs{lhs};
+  std::reverse(rhs.begin(), rhs.end());
+  EXPECT_DOUBLE_EQ(0.0, CalculateHausdorffDistance(lhs, rhs).GetValue(
+                            Distance::Type::kMeter));
+  EXPECT_LE(CalculateHausdorffDistance(lhs, rhs),
+            CalculateDiscreteFrechetDistance(lhs, rhs));
+  EXPECT_EQ(Distance(), CalculateDiscreteFrechetDistance(lhs, lhs));
+  EXPECT_TRUE(IsDiscreteFrechetDistanceWithin(lhs, lhs, Distance()));
+}
+
+TEST(GeometryPolylineDistance, InvalidInput) {
+  const std::vector<Point2D> points{Point2D(0.0, 0.0)};
+  EXPECT_THROW(static_cast<void>(CalculateHausdorffDistance({}, points)),
+               std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(CalculateDiscreteFrechetDistance(points, {})),
+               std::invalid_argument);
+  EXPECT_FALSE(IsHausdorffDistanceWithin(points, points, Distance(-1.0)));
+  EXPECT_FALSE(IsDiscreteFrechetDistanceWithin(points, points, Distance(-1.0)));
+}
+
+}  // namespace geometry
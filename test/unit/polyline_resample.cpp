@@ -0,0 +1,214 @@
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/polyline_resample.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr double kTolerance = 1e-6;
+
+auto MakeRandomWalk(std::size_t count, unsigned seed)
+    -> std::vector<geometry::Point2D> {
+  std::mt19937 random(seed);
+  std::uniform_real_distribution<double> step(-10.0, 10.0);
+  std::vector<geometry::Point2D> points;
+  double x{100.0};
+  double y{-50.0};
+  for (std::size_t i = 0; i < count; ++i) {
+    x += step(random);
+    y += step(random);
+    points.emplace_back(x, y);
+  }
+  return points;
+}
+
+// Sample at arc length s by walking the segments in meters.
+auto ReferencePosition(const std::vector<geometry::Point2D>& points,
+                       double s) -> geometry::Point2D {
+  for (std::size_t i = 0; i + 1 < points.size(); ++i) {
+    const double length{points[i].CalculateDistance(points[i + 1])};
+    if (s <= length && length > 0.0) {
+      return points[i] + ((points[i + 1] - points[i]) * (s / length));
+    }
+    s -= length;
+  }
+  return points.back();
+}
+
+auto ExpectNear(const geometry::Point2D& actual,
+                const geometry::Point2D& expected) -> void {
+  EXPECT_NEAR(actual.GetX(), expected.GetX(), kTolerance);
+  EXPECT_NEAR(actual.GetY(), expected.GetY(), kTolerance);
+}
+}  // namespace
+
+namespace geometry {
+
+TEST(GeometryPolylineResample, LinearAroundCorner) {
+  const std::vector<Point2D> points{{0.0, 0.0}, {10.0, 0.0}, {10.0, 10.0}};
+  const auto samples{ResamplePolyline(points, Distance(4.0))};
+  ASSERT_EQ(samples.size(), 6U);
+  ExpectNear(samples[0], {0.0, 0.0});
+  ExpectNear(samples[1], {4.0, 0.0});
+  ExpectNear(samples[2], {8.0, 0.0});
+  ExpectNear(samples[3], {10.0, 2.0});
+  ExpectNear(samples[4], {10.0, 6.0});
+  ExpectNear(samples[5], {10.0, 10.0});
+
+  // The end is only sampled when it is a multiple of the spacing.
+  const auto inexact{ResamplePolyline(points, Distance(6.0))};
+  ASSERT_EQ(inexact.size(), 4U);
+  ExpectNear(inexact.back(), {10.0, 8.0});
+}
+
+TEST(GeometryPolylineResample, MatchesReference) {
+  const auto points{MakeRandomWalk(1000, 3)};
+  const Distance spacing(0.75);
+  const std::size_t count{
+      GetResampleCount(points.data(), points.size(), spacing)};
+  std::vector<Point2D> samples(count);
+  EXPECT_EQ(ResamplePolyline(points.data(), points.size(), spacing,
+                             Interpolation::kLinear, samples.data()),
+            count);
+  for (std::size_t i = 0; i < count; ++i) {
+    ExpectNear(samples[i],
+               ReferencePosition(points, 0.75 * static_cast<double>(i)));
+  }
+  // Zero length segments and single points.
+  std::vector<Point2D> repeated{points[0], points[0], points[1], points[1]};
+  EXPECT_EQ(ResamplePolyline(repeated, Distance(1e-3)).size(),
+            static_cast<std::size_t>(
+                points[0].CalculateDistance(points[1]) / 1e-3) +
+                1);
+  EXPECT_EQ(ResamplePolyline({points[0]}, spacing).size(), 1U);
+  EXPECT_TRUE(ResamplePolyline({}, spacing).empty());
+}
+
+TEST(GeometryPolylineResample, CatmullRom) {
+  // On evenly spaced collinear points the spline is the line.
+  const std::vector<Point2D> line{
+      {0.0, 0.0}, {1.0, 2.0}, {2.0, 4.0}, {3.0, 6.0}};
+  const auto linear{ResamplePolyline(line, Distance(0.1))};
+  const auto spline{
+      ResamplePolyline(line, Distance(0.1), Interpolation::kCatmullRom)};
+  ASSERT_EQ(linear.size(), spline.size());
+  for (std::size_t i = 0; i < linear.size(); ++i) {
+    ExpectNear(spline[i], linear[i]);
+  }
+
+  // The spline passes through every vertex and leaves the segments between.
+  const std::vector<Point2D> zigzag{
+      {0.0, 0.0}, {6.0, 8.0}, {12.0, 0.0}, {18.0, 8.0}};
+  const auto curve{
+      ResamplePolyline(zigzag, Distance(2.5), Interpolation::kCatmullRom)};
+  ASSERT_EQ(curve.size(), 13U);
+  for (std::size_t i = 0; i < zigzag.size(); ++i) {
+    ExpectNear(curve[i * 4], zigzag[i]);
+  }
+  EXPECT_NEAR(curve[5].GetY(), 6.75, kTolerance);
+}
+
+TEST(GeometryPolylineResample, InterpolateAtArcLengths) {
+  const auto points{MakeRandomWalk(500, 5)};
+  std::mt19937 random(11);
+  double total{0.0};
+  for (std::size_t i = 0; i + 1 < points.size(); ++i) {
+    total += points[i].CalculateDistance(points[i + 1]);
+  }
+  std::uniform_real_distribution<double> arc(-10.0, total + 10.0);
+  std::vector<Distance> arc_lengths;
+  for (int i = 0; i < 2000; ++i) {
+    arc_lengths.emplace_back(arc(random));
+  }
+  for (const auto interpolation :
+       {Interpolation::kLinear, Interpolation::kCatmullRom}) {
+    const auto positions{
+        InterpolateAtArcLengths(points, arc_lengths, interpolation)};
+    auto sorted{arc_lengths};
+    std::sort(sorted.begin(), sorted.end());
+    const auto ascending{
+        InterpolateAtArcLengths(points, sorted, interpolation)};
+    for (std::size_t i = 0; i < arc_lengths.size(); ++i) {
+      const auto found{std::lower_bound(sorted.begin(), sorted.end(),
+                                        arc_lengths[i]) -
+                       sorted.begin()};
+      EXPECT_EQ(positions[i], ascending[static_cast<std::size_t>(found)]);
+      if (interpolation == Interpolation::kLinear) {
+        ExpectNear(positions[i],
+                   ReferencePosition(
+                       points, std::max(0.0, arc_lengths[i].GetValue(
+                                                 Distance::Type::kMeter))));
+      }
+    }
+    // Matches resampling at the same arc lengths.
+    const auto samples{ResamplePolyline(points, Distance(2.0), interpolation)};
+    std::vector<Distance> multiples;
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+      multiples.emplace_back(2.0 * static_cast<double>(i));
+    }
+    const auto at{InterpolateAtArcLengths(points, multiples, interpolation)};
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+      ExpectNear(at[i], samples[i]);
+    }
+  }
+  // Clamped to the ends.
+  const auto ends{InterpolateAtArcLengths(
+      points, {Distance(-1.0), Distance(total + 1.0)})};
+  EXPECT_EQ(ends[0], points.front());
+  EXPECT_EQ(ends[1], points.back());
+  EXPECT_EQ(InterpolateAtArcLengths({points[0]}, {Distance(1.0)})[0],
+            points[0]);
+}
+
+TEST(GeometryPolylineResample, ParallelMatchesSingle) {
+  std::vector<std::vector<Point2D>> polylines;
+  for (unsigned i = 0; i < 300; ++i) {
+    polylines.push_back(MakeRandomWalk(i % 7 == 0 ? 0 : 1 + (i * 3), i));
+  }
+  const Distance spacing(1.5);
+  const auto result{ResamplePolylines(polylines, spacing,
+                                      Interpolation::kCatmullRom, 4)};
+  ASSERT_EQ(result.offsets.size(), polylines.size() + 1);
+  EXPECT_EQ(result.offsets.back(), result.points.size());
+  for (std::size_t i = 0; i < polylines.size(); ++i) {
+    const auto single{
+        ResamplePolyline(polylines[i], spacing, Interpolation::kCatmullRom)};
+    ASSERT_EQ(result.offsets[i + 1] - result.offsets[i], single.size());
+    for (std::size_t j = 0; j < single.size(); ++j) {
+      EXPECT_EQ(result.points[result.offsets[i] + j], single[j]);
+    }
+  }
+}
+
+TEST(GeometryPolylineResample, InvalidInput) {
+  const std::vector<Point2D> points{{0.0, 0.0}, {1.0, 0.0}};
+  EXPECT_THROW(static_cast<void>(ResamplePolyline(points, Distance(0.0))),
+               std::invalid_argument);
+  EXPECT_THROW(
+      static_cast<void>(ResamplePolylines({points}, Distance(-1.0))),
+      std::invalid_argument);
+  const std::vector<Point2D> invalid{
+      {0.0, 0.0}, {std::numeric_limits<double>::quiet_NaN(), 0.0}};
+  EXPECT_THROW(static_cast<void>(ResamplePolyline(invalid, Distance(1.0))),
+               std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(
+                   InterpolateAtArcLengths(invalid, {Distance(1.0)})),
+               std::invalid_argument);
+  EXPECT_THROW(
+      static_cast<void>(InterpolateAtArcLengths({}, {Distance(1.0)})),
+      std::invalid_argument);
+  // Longer than the Distance range.
+  const std::vector<Point2D> huge{{0.0, 0.0}, {8.0e9, 0.0}, {0.0, 0.0}};
+  EXPECT_THROW(static_cast<void>(ResamplePolyline(huge, Distance(1.0))),
+               std::invalid_argument);
+}
+
+}  // namespace geometry
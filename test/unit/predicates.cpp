@@ -0,0 +1,180 @@
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/predicates.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 20000U;
+constexpr int kFractionBits = 20;
+
+auto Sign(double value) -> int { return (value > 0.0) - (value < 0.0); }
+
+// Coordinates are multiples of 2^-kFractionBits below 2^40, so that the
+// orientation is exact in 128 bit integers once scaled.
+auto Snap(double value) -> double {
+  return std::ldexp(std::round(std::ldexp(value, kFractionBits)),
+                    -kFractionBits);
+}
+
+auto Scaled(double value) -> __int128 {
+  return static_cast<__int128>(std::ldexp(value, kFractionBits));
+}
+
+auto ExactOrientSign(const geometry::Point2D& a, const geometry::Point2D& b,
+                     const geometry::Point2D& c) -> int {
+  const __int128 det{
+      ((Scaled(a.GetX()) - Scaled(c.GetX())) *
+       (Scaled(b.GetY()) - Scaled(c.GetY()))) -
+      ((Scaled(a.GetY()) - Scaled(c.GetY())) *
+       (Scaled(b.GetX()) - Scaled(c.GetX())))};
+  return (det > 0) - (det < 0);
+}
+
+auto NaiveOrient(const geometry::Point2D& a, const geometry::Point2D& b,
+                 const geometry::Point2D& c) -> double {
+  return ((a.GetX() - c.GetX()) * (b.GetY() - c.GetY())) -
+         ((a.GetY() - c.GetY()) * (b.GetX() - c.GetX()));
+}
+
+// Far endpoints on a line through the origin and a third point on that line
+// with a fine fractional part, moved off it by at most a few 2^-20 steps.
+// Coordinate differences are then inexact in double precision.
+struct NearCollinear {
+  std::vector<geometry::Point2D> a;
+  std::vector<geometry::Point2D> b;
+  std::vector<geometry::Point2D> c;
+};
+
+auto MakeNearCollinear(uint32_t seed) -> NearCollinear {
+  std::mt19937_64 random(seed);
+  std::uniform_int_distribution<int> direction(1, 1000);
+  std::uniform_int_distribution<int64_t> scale(1LL << 20, 1LL << 28);
+  std::uniform_real_distribution<double> position(-1.0, 1.0);
+  std::uniform_int_distribution<int> offset(-2, 2);
+  NearCollinear input;
+  for (uint32_t test = 0; test < kTestCount; ++test) {
+    const double u{static_cast<double>(direction(random))};
+    const double v{static_cast<double>(direction(random))};
+    const auto s{static_cast<double>(scale(random))};
+    const auto r{static_cast<double>(scale(random))};
+    const double t{Snap(position(random))};
+    const double step{std::ldexp(1.0, -kFractionBits)};
+    input.a.emplace_back(s * u, s * v);
+    input.b.emplace_back(-r * u, -r * v);
+    input.c.emplace_back(t * u + offset(random) * step,
+                         t * v + offset(random) * step);
+  }
+  return input;
+}
+}  // namespace
+
+namespace geometry {
+
+TEST(GeometryPredicates, OrientSimple) {
+  const Point2D a(0.0, 0.0);
+  const Point2D b(1.0, 0.0);
+  EXPECT_GT(Orient2D(a, b, Point2D(0.5, 1.0)), 0.0);
+  EXPECT_LT(Orient2D(a, b, Point2D(0.5, -1.0)), 0.0);
+  EXPECT_EQ(0.0, Orient2D(a, b, Point2D(7.0, 0.0)));
+  EXPECT_DOUBLE_EQ(2.0, Orient2D(0.0, 0.0, 2.0, 0.0, 0.0, 1.0));
+}
+
+TEST(GeometryPredicates, OrientNearCollinear) {
+  const auto input{MakeNearCollinear(1)};
+  std::size_t naive_errors{0};
+  for (std::size_t i = 0; i < input.a.size(); ++i) {
+    const auto& a{input.a[i]};
+    const auto& b{input.b[i]};
+    const auto& c{input.c[i]};
+    const int expected{ExactOrientSign(a, b, c)};
+    ASSERT_EQ(expected, Sign(Orient2D(a, b, c))) << i;
+    ASSERT_EQ(expected, Sign(Orient2D(b, c, a))) << i;
+    ASSERT_EQ(-expected, Sign(Orient2D(b, a, c))) << i;
+    naive_errors += expected != Sign(NaiveOrient(a, b, c)) ? 1 : 0;
+  }
+  // The input defeats plain double arithmetic.
+  EXPECT_GT(naive_errors, 0U);
+
+  std::vector<Point2D> points(input.c);
+  const auto batch{Orient2D(input.a[0], input.b[0], points)};
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    ASSERT_EQ(Orient2D(input.a[0], input.b[0], points[i]), batch[i]);
+  }
+}
+
+TEST(GeometryPredicates, InCircleSimple) {
+  const Point2D a(0.0, 0.0);
+  const Point2D b(2.0, 0.0);
+  const Point2D c(2.0, 2.0);
+  EXPECT_GT(InCircle(a, b, c, Point2D(1.0, 1.0)), 0.0);
+  EXPECT_LT(InCircle(a, b, c, Point2D(5.0, 1.0)), 0.0);
+  EXPECT_LT(InCircle(a, c, b, Point2D(1.0, 1.0)), 0.0);
+  // Grid-snapped corners of a cell are cocircular, also far from the origin.
+  EXPECT_EQ(0.0, InCircle(a, b, c, Point2D(0.0, 2.0)));
+  const double far{1099511627776.0};
+  EXPECT_EQ(0.0, InCircle(Point2D(far, far), Point2D(far + 1.0, far),
+                          Point2D(far + 1.0, far + 1.0),
+                          Point2D(far, far + 1.0)));
+}
+
+TEST(GeometryPredicates, InCircleNearCocircular) {
+  // Points close to a circle whose center has an inexact binary fraction.
+  std::mt19937_64 random(2);
+  std::uniform_real_distribution<double> angle(0.0, 6.283185307179586);
+  std::uniform_real_distribution<double> radius(1.0, 1e9);
+  const Point2D center(0.1, 0.3);
+  std::vector<Point2D> tested;
+  std::vector<Point2D> circle;
+  for (uint32_t test = 0; test < kTestCount; ++test) {
+    const double r{radius(random)};
+    Point2D points[4];
+    for (auto& point : points) {
+      const double theta{angle(random)};
+      point = Point2D(center.GetX() + (r * std::cos(theta)),
+                      center.GetY() + (r * std::sin(theta)));
+    }
+    const auto& [a, b, c, d] = points;
+    const int sign{Sign(InCircle(a, b, c, d))};
+    // The lifted determinant is alternating in its four points.
+    ASSERT_EQ(sign, Sign(InCircle(b, c, a, d))) << test;
+    ASSERT_EQ(-sign, Sign(InCircle(b, a, c, d))) << test;
+    ASSERT_EQ(-sign, Sign(InCircle(b, c, d, a))) << test;
+    ASSERT_EQ(sign, Sign(InCircle(c, d, a, b))) << test;
+    if (test < 3) {
+      circle.insert(circle.end(), {a, b, c});
+    }
+    tested.push_back(d);
+  }
+
+  const auto batch{InCircle(circle[0], circle[1], circle[2], tested)};
+  for (std::size_t i = 0; i < tested.size(); ++i) {
+    ASSERT_EQ(InCircle(circle[0], circle[1], circle[2], tested[i]), batch[i]);
+  }
+}
+
+TEST(GeometryPredicates, InCircleTangent) {
+  // A circle of radius 5 * 2^38 through the origin, tangent to the y axis.
+  // Tested points near the origin make every coordinate difference inexact
+  // and leave a determinant far below the error of the double terms.
+  const double unit{std::ldexp(1.0, 38)};
+  const double radius{5.0 * unit};
+  const Point2D a(radius + (3.0 * unit), -4.0 * unit);
+  const Point2D b(radius + (3.0 * unit), 4.0 * unit);
+  const Point2D c(radius - (3.0 * unit), 4.0 * unit);
+  EXPECT_EQ(0.0, InCircle(a, b, c, Point2D(0.0, 0.0)));
+  for (int exponent = 0; exponent <= 60; ++exponent) {
+    const double y{std::ldexp(1.0, -exponent)};
+    EXPECT_LT(InCircle(a, b, c, Point2D(0.0, y)), 0.0) << exponent;
+    EXPECT_LT(InCircle(a, b, c, Point2D(0.0, -y)), 0.0) << exponent;
+    EXPECT_GT(InCircle(a, b, c, Point2D(y * y, y)), 0.0) << exponent;
+  }
+}
+
+}  // namespace geometry
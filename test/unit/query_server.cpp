@@ -0,0 +1,384 @@
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "query_server.hpp"
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "protocol.hpp"
+
+namespace {
+using geometry::query_server::QueryType;
+using geometry::query_server::Request;
+using geometry::query_server::Status;
+
+constexpr std::size_t kPointCount = 2000U;
+
+auto MakePoints(std::size_t count) -> std::vector<geometry::Point2D> {
+  std::mt19937_64 random(11);
+  std::uniform_real_distribution<double> coordinate(-500.0, 500.0);
+  std::vector<geometry::Point2D> points;
+  for (std::size_t i = 0; i < count; ++i) {
+    points.emplace_back(coordinate(random), coordinate(random));
+  }
+  return points;
+}
+
+auto LoadLittleEndian(const uint8_t* bytes, std::size_t size) -> uint64_t {
+  uint64_t value{0};
+  for (std::size_t i = 0; i < size; ++i) {
+    value |= static_cast<uint64_t>(bytes[i]) << (8U * i);
+  }
+  return value;
+}
+
+auto GetBits(double value) -> uint64_t {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+auto AppendRequest(const Request& request, std::vector<uint8_t>& bytes)
+    -> void {
+  bytes.resize(bytes.size() + geometry::query_server::kRequestSize);
+  geometry::query_server::EncodeRequest(
+      request, bytes.data() + bytes.size() -
+                   geometry::query_server::kRequestSize);
+}
+
+// A decoded response.
+struct Answer {
+  Status status{Status::kOk};
+  std::vector<std::pair<uint32_t, double>> neighbours;
+};
+
+// Serve the encoded requests over a socket pair and decode the responses by
+// request id.
+auto Serve(const geometry::query_server::QueryServer& server,
+           const std::vector<uint8_t>& requests,
+           geometry::query_server::ServeStats& stats)
+    -> std::map<uint32_t, Answer> {
+  int sockets[2];
+  if (::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) != 0) {
+    throw std::system_error(errno, std::generic_category(), "socketpair");
+  }
+  std::thread serving([&] {
+    stats = server.Serve(sockets[1], sockets[1]);
+    ::shutdown(sockets[1], SHUT_WR);
+  });
+  std::thread sender([&] {
+    std::size_t sent{0};
+    while (sent < requests.size()) {
+      const ssize_t size{
+          ::write(sockets[0], requests.data() + sent, requests.size() - sent)};
+      if (size <= 0) {
+        break;
+      }
+      sent += static_cast<std::size_t>(size);
+    }
+    ::shutdown(sockets[0], SHUT_WR);
+  });
+  std::vector<uint8_t> responses;
+  uint8_t buffer[4096];
+  ssize_t size;
+  while ((size = ::read(sockets[0], buffer, sizeof(buffer))) > 0) {
+    responses.insert(responses.end(), buffer, buffer + size);
+  }
+  sender.join();
+  serving.join();
+  ::close(sockets[0]);
+  ::close(sockets[1]);
+
+  EXPECT_EQ(stats.bytes_written, responses.size());
+  std::map<uint32_t, Answer> answers;
+  std::size_t offset{0};
+  while (offset + geometry::query_server::kResponseHeaderSize <=
+         responses.size()) {
+    const auto header{geometry::query_server::DecodeResponseHeader(
+        responses.data() + offset)};
+    offset += geometry::query_server::kResponseHeaderSize;
+    EXPECT_EQ(answers.count(header.id), 0U) << header.id;
+    Answer& answer{answers[header.id]};
+    answer.status = header.status;
+    for (uint32_t i = 0; i < header.count; ++i) {
+      uint32_t index{0};
+      double distance{0.0};
+      geometry::query_server::DecodeNeighbour(responses.data() + offset, index,
+                                              distance);
+      offset += geometry::query_server::kNeighbourSize;
+      answer.neighbours.emplace_back(index, distance);
+    }
+  }
+  EXPECT_EQ(offset, responses.size());
+  return answers;
+}
+
+// Points by distance to (x, y), nearest first.
+auto RankByDistance(const std::vector<geometry::Point2D>& points, double x,
+                    double y) -> std::vector<std::pair<double, uint32_t>> {
+  std::vector<std::pair<double, uint32_t>> ranked;
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    ranked.emplace_back(std::hypot(points[i].GetX() - x, points[i].GetY() - y),
+                        static_cast<uint32_t>(i));
+  }
+  std::sort(ranked.begin(), ranked.end());
+  return ranked;
+}
+
+auto ExpectNeighbours(const Answer& answer,
+                      const std::vector<std::pair<double, uint32_t>>& ranked,
+                      std::size_t count) -> void {
+  ASSERT_EQ(answer.status, Status::kOk);
+  ASSERT_EQ(answer.neighbours.size(), count);
+  for (std::size_t i = 0; i < count; ++i) {
+    EXPECT_EQ(answer.neighbours[i].first, ranked[i].second) << i;
+    EXPECT_NEAR(answer.neighbours[i].second, ranked[i].first, 1e-6) << i;
+  }
+}
+}  // namespace
+
+namespace geometry {
+namespace query_server {
+
+TEST(GeometryQueryServer, RequestLayout) {
+  const Request request{0x04030201U, QueryType::kRadius, 0x0C0B0A09U, 1.5,
+                        -2.25, 1e9};
+  uint8_t bytes[kRequestSize];
+  std::memset(bytes, 0xFF, sizeof(bytes));
+  EncodeRequest(request, bytes);
+  EXPECT_EQ(LoadLittleEndian(bytes, 4), 0x04030201U);
+  EXPECT_EQ(bytes[0], 0x01U);
+  EXPECT_EQ(bytes[4], 2U);
+  EXPECT_EQ(LoadLittleEndian(bytes + 5, 3), 0U);
+  EXPECT_EQ(LoadLittleEndian(bytes + 8, 4), 0x0C0B0A09U);
+  EXPECT_EQ(LoadLittleEndian(bytes + 12, 8), GetBits(1.5));
+  EXPECT_EQ(LoadLittleEndian(bytes + 20, 8), GetBits(-2.25));
+  EXPECT_EQ(LoadLittleEndian(bytes + 28, 8), GetBits(1e9));
+  EXPECT_EQ(kRequestSize, 36U);
+}
+
+TEST(GeometryQueryServer, ResponseLayout) {
+  std::vector<uint8_t> buffer{7, 7, 7};
+  AppendResponseHeader({0x11223344U, Status::kBadRequest, 0x0A0B0C0DU},
+                       buffer);
+  ASSERT_EQ(buffer.size(), 3 + kResponseHeaderSize);
+  EXPECT_EQ(buffer[0], 7U);
+  EXPECT_EQ(LoadLittleEndian(buffer.data() + 3, 4), 0x11223344U);
+  EXPECT_EQ(buffer[7], 1U);
+  EXPECT_EQ(LoadLittleEndian(buffer.data() + 8, 3), 0U);
+  EXPECT_EQ(LoadLittleEndian(buffer.data() + 11, 4), 0x0A0B0C0DU);
+
+  AppendNeighbour(0xA0B0C0D0U, 2.5, buffer);
+  ASSERT_EQ(buffer.size(), 3 + kResponseHeaderSize + kNeighbourSize);
+  EXPECT_EQ(LoadLittleEndian(buffer.data() + 15, 4), 0xA0B0C0D0U);
+  EXPECT_EQ(LoadLittleEndian(buffer.data() + 19, 8), GetBits(2.5));
+}
+
+TEST(GeometryQueryServer, RoundTrip) {
+  const double infinity{std::numeric_limits<double>::infinity()};
+  for (const Request& request :
+       {Request{0, QueryType::kNearest, 1, 0.0, -0.0, 0.0},
+        Request{0xFFFFFFFFU, QueryType::kRadius, 0xFFFFFFFFU, -infinity,
+                1e300, infinity},
+        Request{42, static_cast<QueryType>(200), 7, 312000.125, -4.5e-9,
+                33.0}}) {
+    uint8_t bytes[kRequestSize];
+    EncodeRequest(request, bytes);
+    const Request decoded{DecodeRequest(bytes)};
+    EXPECT_EQ(decoded.id, request.id);
+    EXPECT_EQ(decoded.type, request.type);
+    EXPECT_EQ(decoded.limit, request.limit);
+    EXPECT_EQ(GetBits(decoded.x), GetBits(request.x));
+    EXPECT_EQ(GetBits(decoded.y), GetBits(request.y));
+    EXPECT_EQ(GetBits(decoded.radius), GetBits(request.radius));
+  }
+
+  std::vector<uint8_t> buffer;
+  AppendResponseHeader({9, Status::kOk, 2}, buffer);
+  AppendNeighbour(3, 0.25, buffer);
+  AppendNeighbour(0xFFFFFFFFU, 1e9, buffer);
+  const ResponseHeader header{DecodeResponseHeader(buffer.data())};
+  EXPECT_EQ(header.id, 9U);
+  EXPECT_EQ(header.status, Status::kOk);
+  EXPECT_EQ(header.count, 2U);
+  uint32_t index{0};
+  double distance{0.0};
+  DecodeNeighbour(buffer.data() + kResponseHeaderSize, index, distance);
+  EXPECT_EQ(index, 3U);
+  EXPECT_EQ(distance, 0.25);
+  DecodeNeighbour(buffer.data() + kResponseHeaderSize + kNeighbourSize, index,
+                  distance);
+  EXPECT_EQ(index, 0xFFFFFFFFU);
+  EXPECT_EQ(distance, 1e9);
+}
+
+TEST(GeometryQueryServer, Answers) {
+  const auto points{MakePoints(kPointCount)};
+  ServerOptions options;
+  options.worker_count = 3;
+  options.batch_size = 4;
+  const QueryServer server(points, options);
+
+  std::mt19937_64 random(12);
+  std::uniform_real_distribution<double> coordinate(-600.0, 600.0);
+  std::vector<Request> requests;
+  for (uint32_t id = 0; id < 300; ++id) {
+    Request request;
+    request.id = 1000 + id;
+    request.x = coordinate(random);
+    request.y = coordinate(random);
+    if (id % 3 == 0) {
+      request.type = QueryType::kNearest;
+      request.limit = 1 + (id % 17);
+    } else {
+      request.type = QueryType::kRadius;
+      request.radius = 5.0 + (id % 40);
+      // Every other radius query keeps only its nearest matches.
+      request.limit = id % 2 == 0 ? 0 : 1 + (id % 7);
+    }
+    requests.push_back(request);
+  }
+  std::vector<uint8_t> bytes;
+  for (const auto& request : requests) {
+    AppendRequest(request, bytes);
+  }
+  // A trailing partial request is dropped.
+  bytes.resize(bytes.size() + 10, 0xAB);
+
+  ServeStats stats;
+  const auto answers{Serve(server, bytes, stats)};
+  ASSERT_EQ(answers.size(), requests.size());
+  std::size_t neighbours{0};
+  for (const auto& request : requests) {
+    const auto& answer{answers.at(request.id)};
+    const auto ranked{RankByDistance(points, request.x, request.y)};
+    std::size_t count{request.limit};
+    if (request.type == QueryType::kRadius) {
+      count = static_cast<std::size_t>(std::count_if(
+          ranked.begin(), ranked.end(), [&request](const auto& match) {
+            return match.first <= request.radius;
+          }));
+      if (request.limit != 0) {
+        count = std::min<std::size_t>(count, request.limit);
+      }
+    }
+    ExpectNeighbours(answer, ranked, count);
+    neighbours += count;
+  }
+  EXPECT_EQ(stats.requests, requests.size());
+  EXPECT_EQ(stats.bad_requests, 0U);
+  EXPECT_EQ(stats.neighbours, neighbours);
+  EXPECT_EQ(stats.bytes_read, bytes.size());
+  EXPECT_EQ(stats.bytes_written,
+            (requests.size() * kResponseHeaderSize) +
+                (neighbours * kNeighbourSize));
+  EXPECT_GE(stats.batches, requests.size() / options.batch_size);
+  ASSERT_EQ(stats.latencies.size(), requests.size());
+  EXPECT_TRUE(std::is_sorted(stats.latencies.begin(), stats.latencies.end()));
+  EXPECT_GT(stats.GetThroughput(), 0.0);
+}
+
+TEST(GeometryQueryServer, BadRequests) {
+  const double nan{std::numeric_limits<double>::quiet_NaN()};
+  const double infinity{std::numeric_limits<double>::infinity()};
+  const auto points{MakePoints(100)};
+  ServerOptions options;
+  options.worker_count = 2;
+  options.max_limit = 8;
+  const QueryServer server(points, options);
+  const std::vector<Request> bad{
+      {1, QueryType::kNearest, 0, 0.0, 0.0, 0.0},
+      {2, QueryType::kNearest, 9, 0.0, 0.0, 0.0},
+      {3, QueryType::kNearest, 1, nan, 0.0, 0.0},
+      {4, QueryType::kRadius, 0, 0.0, infinity, 10.0},
+      {5, QueryType::kRadius, 0, 0.0, 0.0, -1.0},
+      {6, QueryType::kRadius, 0, 0.0, 0.0, 2e9},
+      {7, QueryType::kRadius, 0, 0.0, 0.0, nan},
+      {8, QueryType::kRadius, 9, 0.0, 0.0, 10.0},
+      {9, static_cast<QueryType>(0), 1, 0.0, 0.0, 10.0},
+      {10, static_cast<QueryType>(3), 1, 0.0, 0.0, 10.0}};
+  const std::vector<Request> good{
+      {11, QueryType::kNearest, 8, 0.0, 0.0, 0.0},
+      {12, QueryType::kRadius, 8, 0.0, 0.0, 1e9}};
+  std::vector<uint8_t> bytes;
+  for (const auto& request : bad) {
+    AppendRequest(request, bytes);
+  }
+  for (const auto& request : good) {
+    AppendRequest(request, bytes);
+  }
+
+  ServeStats stats;
+  const auto answers{Serve(server, bytes, stats)};
+  ASSERT_EQ(answers.size(), bad.size() + good.size());
+  for (const auto& request : bad) {
+    EXPECT_EQ(answers.at(request.id).status, Status::kBadRequest)
+        << request.id;
+    EXPECT_TRUE(answers.at(request.id).neighbours.empty()) << request.id;
+  }
+  const auto ranked{RankByDistance(points, 0.0, 0.0)};
+  for (const auto& request : good) {
+    ExpectNeighbours(answers.at(request.id), ranked, 8);
+  }
+  EXPECT_EQ(stats.requests, bad.size() + good.size());
+  EXPECT_EQ(stats.bad_requests, bad.size());
+  EXPECT_EQ(stats.neighbours, 16U);
+}
+
+TEST(GeometryQueryServer, Empty) {
+  const QueryServer server(MakePoints(10));
+  ServeStats stats;
+  EXPECT_TRUE(Serve(server, {}, stats).empty());
+  EXPECT_EQ(stats.requests, 0U);
+  EXPECT_EQ(stats.batches, 0U);
+  EXPECT_EQ(stats.GetLatency(0.5), 0U);
+}
+
+TEST(GeometryQueryServer, Latency) {
+  ServeStats stats;
+  EXPECT_EQ(stats.GetLatency(0.0), 0U);
+  EXPECT_EQ(stats.GetLatency(1.0), 0U);
+  EXPECT_EQ(stats.GetThroughput(), 0.0);
+  stats.latencies = {10, 20, 30, 40, 50};
+  EXPECT_EQ(stats.GetLatency(0.0), 10U);
+  EXPECT_EQ(stats.GetLatency(0.25), 20U);
+  // Ranks between samples round up.
+  EXPECT_EQ(stats.GetLatency(0.3), 30U);
+  EXPECT_EQ(stats.GetLatency(0.5), 30U);
+  EXPECT_EQ(stats.GetLatency(0.99), 50U);
+  EXPECT_EQ(stats.GetLatency(1.0), 50U);
+  EXPECT_EQ(stats.GetLatency(-1.0), 10U);
+  EXPECT_EQ(stats.GetLatency(2.0), 50U);
+  stats.requests = 10;
+  stats.seconds = 2.0;
+  EXPECT_EQ(stats.GetThroughput(), 5.0);
+}
+
+TEST(GeometryQueryServer, InvalidInput) {
+  const auto points{MakePoints(10)};
+  ServerOptions options;
+  options.batch_size = 0;
+  EXPECT_THROW(QueryServer(points, options), std::invalid_argument);
+  EXPECT_THROW(
+      QueryServer({Point2D(std::numeric_limits<double>::quiet_NaN(), 0.0)}),
+      std::invalid_argument);
+  const QueryServer server(points);
+  EXPECT_THROW(static_cast<void>(server.Serve(-1, -1)), std::system_error);
+}
+
+}  // namespace query_server
+}  // namespace geometry
@@ -0,0 +1,148 @@
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/space_filling_curve.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 10000U;
+constexpr std::size_t kPointCount = 200000U;
+constexpr uint32_t kGridBits = 6U;
+
+auto MakePoints(std::size_t count) -> std::vector<geometry::Point2D> {
+  std::vector<geometry::Point2D> points;
+  for (std::size_t i = 0; i < count; ++i) {
+    // Coarse coordinates, so that some points share a key.
+    points.emplace_back(static_cast<double>(std::rand() % 5000) / 10.0,
+                        static_cast<double>(std::rand() % 3000) / 10.0 - 50.0);
+  }
+  return points;
+}
+
+// Consecutive positions of a curve over a 2^kGridBits grid are adjacent cells
+// if the curve is continuous, and every cell has one position.
+auto ExpectCurve(const std::vector<uint64_t>& keys,
+                 const std::vector<uint32_t>& columns,
+                 const std::vector<uint32_t>& rows, bool continuous) -> void {
+  std::vector<uint32_t> cells(keys.size(), keys.size());
+  for (uint32_t cell = 0; cell < keys.size(); ++cell) {
+    ASSERT_LT(keys[cell], keys.size());
+    cells[keys[cell]] = cell;
+  }
+  for (std::size_t key = 1; key < cells.size(); ++key) {
+    ASSERT_LT(cells[key], keys.size());
+    const auto dx{static_cast<int>(columns[cells[key]]) -
+                  static_cast<int>(columns[cells[key - 1]])};
+    const auto dy{static_cast<int>(rows[cells[key]]) -
+                  static_cast<int>(rows[cells[key - 1]])};
+    if (continuous) {
+      ASSERT_EQ(1, std::abs(dx) + std::abs(dy)) << key;
+    }
+  }
+}
+}  // namespace
+
+namespace geometry {
+
+TEST(GeometrySpaceFillingCurve, MortonInterleavesBits) {
+  std::mt19937 random(3);
+  for (uint32_t test = 0; test < kTestCount; ++test) {
+    const auto x{static_cast<uint32_t>(random())};
+    const auto y{static_cast<uint32_t>(random())};
+    uint64_t expected{0};
+    for (uint32_t bit = 0; bit < 32; ++bit) {
+      expected |= static_cast<uint64_t>((x >> bit) & 1U) << (2 * bit);
+      expected |= static_cast<uint64_t>((y >> bit) & 1U) << (2 * bit + 1);
+    }
+    EXPECT_EQ(expected, EncodeMorton(x, y));
+  }
+}
+
+TEST(GeometrySpaceFillingCurve, HilbertIsContinuous) {
+  constexpr uint32_t kSide{1U << kGridBits};
+  constexpr uint32_t kShift{32 - kGridBits};
+  std::vector<uint32_t> columns;
+  std::vector<uint32_t> rows;
+  std::vector<uint64_t> low;
+  std::vector<uint64_t> high;
+  std::vector<uint64_t> morton;
+  for (uint32_t x = 0; x < kSide; ++x) {
+    for (uint32_t y = 0; y < kSide; ++y) {
+      columns.push_back(x);
+      rows.push_back(y);
+      // The finest cells near the origin and the coarsest levels of the curve.
+      low.push_back(EncodeHilbert(x, y));
+      high.push_back(EncodeHilbert((x << kShift) | (std::rand() % 1000),
+                                   (y << kShift) | (std::rand() % 1000)) >>
+                     (2 * kShift));
+      morton.push_back(EncodeMorton(x, y));
+    }
+  }
+  ExpectCurve(low, columns, rows, true);
+  ExpectCurve(high, columns, rows, true);
+  ExpectCurve(morton, columns, rows, false);
+  EXPECT_EQ(0U, EncodeHilbert(0, 0));
+}
+
+TEST(GeometrySpaceFillingCurve, ReorderSortsByKey) {
+  for (const auto curve :
+       {SpaceFillingCurve::kMorton, SpaceFillingCurve::kHilbert}) {
+    const auto points{MakePoints(kPointCount)};
+    const Point2D min_corner(0.0, -50.0);
+    const Point2D max_corner(499.9, 249.9);
+    std::vector<uint64_t> keys(points.size());
+    ComputeCurveKeys(points.data(), points.size(), min_corner, max_corner,
+                     curve, keys.data());
+    std::vector<uint32_t> expected(points.size());
+    std::iota(expected.begin(), expected.end(), 0U);
+    std::stable_sort(expected.begin(), expected.end(),
+                     [&keys](uint32_t lhs, uint32_t rhs) {
+                       return keys[lhs] < keys[rhs];
+                     });
+
+    auto reordered{points};
+    std::vector<uint32_t> payload(points.size());
+    std::iota(payload.begin(), payload.end(), 100U);
+    const auto order{ReorderAlongCurve(reordered, curve, 4)};
+    ApplyPermutation(order, payload);
+    EXPECT_EQ(expected, order);
+    EXPECT_EQ(order, ComputeCurveOrder(points, curve, 1));
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      ASSERT_EQ(points[order[i]], reordered[i]);
+      ASSERT_EQ(order[i] + 100U, payload[i]);
+    }
+    EXPECT_EQ(keys[order[0]], ComputeCurveKey(reordered[0], min_corner,
+                                              max_corner, curve));
+  }
+}
+
+TEST(GeometrySpaceFillingCurve, DegenerateInput) {
+  std::vector<Point2D> points;
+  EXPECT_TRUE(ReorderAlongCurve(points, SpaceFillingCurve::kHilbert).empty());
+  points.assign(10, Point2D(1.0, 2.0));
+  const auto order{ReorderAlongCurve(points, SpaceFillingCurve::kHilbert)};
+  std::vector<uint32_t> identity(points.size());
+  std::iota(identity.begin(), identity.end(), 0U);
+  EXPECT_EQ(identity, order);
+
+  // Points outside the box clamp to the border cells.
+  const Point2D min_corner(0.0, 0.0);
+  const Point2D max_corner(1.0, 1.0);
+  EXPECT_EQ(0U, ComputeCurveKey(Point2D(-5.0, -5.0), min_corner, max_corner,
+                                SpaceFillingCurve::kMorton));
+  EXPECT_EQ(~uint64_t{0}, ComputeCurveKey(Point2D(5.0, 5.0), min_corner,
+                                          max_corner,
+                                          SpaceFillingCurve::kMorton));
+  std::vector<int> payload(3);
+  EXPECT_THROW(ApplyPermutation(order, payload), std::invalid_argument);
+}
+
+}  // namespace geometry
@@ -0,0 +1,228 @@
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/tracked_polyline.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr std::size_t kPointCount = 20000U;
+
+// A vehicle track: short steps, stops that repeat a point and rare jumps of
+// up to a kilometer, so blocks hold zero-length segments, segments crossing
+// into the next block vary widely in length and block boxes lie far apart.
+auto MakeTrack(std::size_t count, unsigned seed)
+    -> std::vector<geometry::Point2D> {
+  std::mt19937 random(seed);
+  std::uniform_real_distribution<double> step(-10.0, 10.0);
+  std::uniform_real_distribution<double> jump(-1000.0, 1000.0);
+  std::uniform_int_distribution<int> kind(0, 99);
+  std::vector<geometry::Point2D> points;
+  double x{500.0};
+  double y{-300.0};
+  for (std::size_t i = 0; i < count; ++i) {
+    const int next{kind(random)};
+    if (next < 2) {
+      x += jump(random);
+      y += jump(random);
+    } else if (next >= 10) {
+      x += step(random);
+      y += step(random);
+    }
+    points.emplace_back(x, y);
+  }
+  return points;
+}
+
+auto SegmentNanometers(const geometry::Point2D& from,
+                       const geometry::Point2D& to) -> int64_t {
+  return std::llround(from.CalculateDistance(to) * 1e9);
+}
+
+// Compare every cached quantity with a rescan of the points.
+auto ExpectMatchesRescan(const geometry::TrackedPolyline& polyline) -> void {
+  const auto& points{polyline.GetPoints()};
+  geometry::BoundingBoxAccumulator box;
+  box.Add(points);
+  geometry::CentroidAccumulator centroid;
+  centroid.Add(points);
+  const auto& cached{polyline.GetBoundingBox().GetState()};
+  EXPECT_EQ(cached.count, box.GetState().count);
+  EXPECT_EQ(cached.min_x, box.GetState().min_x);
+  EXPECT_EQ(cached.min_y, box.GetState().min_y);
+  EXPECT_EQ(cached.max_x, box.GetState().max_x);
+  EXPECT_EQ(cached.max_y, box.GetState().max_y);
+  EXPECT_NEAR(polyline.GetCentroid().GetX(), centroid.GetCentroid().GetX(),
+              1e-9);
+  EXPECT_NEAR(polyline.GetCentroid().GetY(), centroid.GetCentroid().GetY(),
+              1e-9);
+  int64_t arc_length{0};
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    ASSERT_EQ(polyline.GetArcLength(i).GetNanometer(), arc_length);
+    if (i + 1 < points.size()) {
+      arc_length += SegmentNanometers(points[i], points[i + 1]);
+    }
+  }
+  EXPECT_EQ(polyline.GetLength().GetNanometer(), arc_length);
+  EXPECT_EQ(polyline.GetStaleBlockCount(), 0U);
+}
+}  // namespace
+
+namespace geometry {
+
+TEST(GeometryTrackedPolyline, EditsMatchRescan) {
+  TrackedPolyline polyline(MakeTrack(kPointCount, 1));
+  ExpectMatchesRescan(polyline);
+  std::mt19937 random(2);
+  std::uniform_int_distribution<std::size_t> index(0, kPointCount - 1);
+  std::uniform_real_distribution<double> coordinate(-2000.0, 2000.0);
+  for (int batch = 0; batch < 20; ++batch) {
+    for (int edit = 0; edit < 10; ++edit) {
+      const std::size_t i{index(random)};
+      switch (edit % 3) {
+        case 0:
+          polyline.Set(i, Point2D(coordinate(random), coordinate(random)));
+          break;
+        case 1:
+          polyline.SetX(i, coordinate(random));
+          break;
+        default:
+          polyline.SetY(i, coordinate(random));
+          break;
+      }
+    }
+    // Moving the extreme points shrinks the box again.
+    if (batch == 10) {
+      for (std::size_t i = 0; i < kPointCount; i += 997) {
+        polyline.Set(i, Point2D(0.0, 0.0));
+      }
+    }
+    ExpectMatchesRescan(polyline);
+  }
+  EXPECT_EQ(polyline.GetVersion(), 200U + ((kPointCount + 996) / 997));
+}
+
+TEST(GeometryTrackedPolyline, OnlyTouchedBlocksAreStale) {
+  TrackedPolyline polyline(MakeTrack(100 * TrackedPolyline::kBlockSize, 3));
+  EXPECT_EQ(polyline.GetBlockCount(), 100U);
+  EXPECT_EQ(polyline.GetStaleBlockCount(), 100U);
+  polyline.Refresh();
+  EXPECT_EQ(polyline.GetStaleBlockCount(), 0U);
+
+  const std::size_t first{5 * TrackedPolyline::kBlockSize};
+  const uint64_t version{polyline.GetBlockVersion(5)};
+  polyline.SetX(first + 1, 0.0);
+  polyline.SetY(first + 2, 0.0);
+  EXPECT_EQ(polyline.GetStaleBlockCount(), 1U);
+  EXPECT_EQ(polyline.GetBlockVersion(5), version + 2);
+  // The first point of a block also ends the segment leaving the previous.
+  polyline.Set(first, Point2D(1.0, 1.0));
+  EXPECT_EQ(polyline.GetStaleBlockCount(), 2U);
+  EXPECT_EQ(polyline.GetBlockVersion(4), version + 1);
+  EXPECT_EQ(polyline.GetBlockVersion(6), version);
+  ExpectMatchesRescan(polyline);
+}
+
+TEST(GeometryTrackedPolyline, PushBack) {
+  TrackedPolyline polyline;
+  EXPECT_EQ(polyline.GetLength().GetNanometer(), 0);
+  EXPECT_EQ(polyline.GetBoundingBox().GetCount(), 0U);
+  EXPECT_THROW(static_cast<void>(polyline.GetCentroid()), std::logic_error);
+  const auto points{MakeTrack(5 * TrackedPolyline::kBlockSize + 7, 4)};
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    polyline.PushBack(points[i]);
+    // Query across block and tree growth.
+    if (i % 700 == 0 || i % TrackedPolyline::kBlockSize <= 1) {
+      ExpectMatchesRescan(polyline);
+    }
+  }
+  EXPECT_EQ(polyline.GetBlockCount(), 6U);
+  ExpectMatchesRescan(polyline);
+  TrackedPolyline built(points);
+  EXPECT_EQ(built.GetLength(), polyline.GetLength());
+}
+
+TEST(GeometryTrackedPolyline, ForEachInRadius) {
+  TrackedPolyline polyline(MakeTrack(kPointCount, 5));
+  std::mt19937 random(6);
+  std::uniform_int_distribution<std::size_t> index(0, kPointCount - 1);
+  for (int round = 0; round < 20; ++round) {
+    for (int edit = 0; edit < 10; ++edit) {
+      polyline.Set(index(random), Point2D(500.0 + round, -300.0 + edit));
+    }
+    const Point2D center(polyline.Get(index(random)));
+    const Distance radius(40.0);
+    std::vector<uint32_t> found;
+    polyline.ForEachInRadius(center, radius,
+                             [&found](uint32_t i, double squared) {
+                               EXPECT_LE(squared, 1600.0);
+                               found.push_back(i);
+                             });
+    std::sort(found.begin(), found.end());
+    std::vector<uint32_t> expected;
+    for (std::size_t i = 0; i < kPointCount; ++i) {
+      const double dx{polyline.Get(i).GetX() - center.GetX()};
+      const double dy{polyline.Get(i).GetY() - center.GetY()};
+      if ((dx * dx) + (dy * dy) <= 1600.0) {
+        expected.push_back(static_cast<uint32_t>(i));
+      }
+    }
+    EXPECT_EQ(found, expected);
+  }
+}
+
+TEST(GeometryTrackedPolyline, InvalidInput) {
+  const double nan{std::numeric_limits<double>::quiet_NaN()};
+  EXPECT_THROW(TrackedPolyline({Point2D(0.0, 0.0), Point2D(nan, 0.0)}),
+               std::invalid_argument);
+  EXPECT_THROW(TrackedPolyline({Point2D(0.0, 0.0), Point2D(1e10, 0.0)}),
+               std::invalid_argument);
+  TrackedPolyline polyline(MakeTrack(10, 7));
+  const uint64_t version{polyline.GetVersion()};
+  EXPECT_THROW(polyline.Set(10, Point2D()), std::invalid_argument);
+  EXPECT_THROW(polyline.SetX(3, nan), std::invalid_argument);
+  EXPECT_THROW(polyline.SetY(3, 1e10), std::invalid_argument);
+  EXPECT_THROW(polyline.PushBack(Point2D(nan, 0.0)), std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(polyline.GetArcLength(10)),
+               std::invalid_argument);
+  // Rejected edits change nothing.
+  EXPECT_EQ(polyline.GetVersion(), version);
+  EXPECT_EQ(polyline.GetSize(), 10U);
+  ExpectMatchesRescan(polyline);
+}
+
+TEST(GeometryTrackedPolyline, LengthOverflow) {
+  // Every segment is in range, but together they are not.
+  EXPECT_THROW(TrackedPolyline({Point2D(0.0, 0.0), Point2D(8e9, 0.0),
+                                Point2D(0.0, 0.0)}),
+               std::invalid_argument);
+  TrackedPolyline polyline(
+      {Point2D(0.0, 0.0), Point2D(4e9, 0.0), Point2D(8e9, 0.0)});
+  const Distance length{polyline.GetLength()};
+  const uint64_t version{polyline.GetVersion()};
+  EXPECT_THROW(polyline.SetX(2, 9.3e9), std::invalid_argument);
+  EXPECT_THROW(polyline.Set(0, Point2D(-1.3e9, 0.0)), std::invalid_argument);
+  EXPECT_THROW(polyline.SetY(1, 3e9), std::invalid_argument);
+  EXPECT_THROW(polyline.PushBack(Point2D(0.0, 0.0)), std::invalid_argument);
+  EXPECT_THROW(polyline.PushBack(Point2D(9.3e9, 0.0)), std::invalid_argument);
+  EXPECT_EQ(polyline.GetVersion(), version);
+  EXPECT_EQ(polyline.GetSize(), 3U);
+  EXPECT_EQ(polyline.GetLength(), length);
+
+  // Shortening one segment makes room for a longer one.
+  polyline.SetX(1, 8e9);
+  polyline.PushBack(Point2D(9.2e9, 0.0));
+  EXPECT_EQ(polyline.GetLength(), Distance(9.2e9));
+  ExpectMatchesRescan(polyline);
+}
+
+}  // namespace geometry
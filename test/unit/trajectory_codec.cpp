@@ -0,0 +1,150 @@
+// Copyright (c) 2023 Programmers, All Rights Reserved.
+// Authors: Jeonghoon Park
+
+#include "geometry/trajectory_codec.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 20U;
+constexpr std::size_t kPointCount = 10000U;
+
+// A vehicle-like trace: one sample per second at up to about 20 m/s.
+auto MakeTrace(std::size_t count, double origin)
+    -> std::vector<geometry::Point2D> {
+  std::vector<geometry::Point2D> points;
+  double x{origin};
+  double y{-origin / 2.0};
+  for (std::size_t i = 0; i < count; ++i) {
+    x += static_cast<double>(std::rand()) / RAND_MAX * 20.0;
+    y += (static_cast<double>(std::rand()) / RAND_MAX * 20.0) - 10.0;
+    points.emplace_back(x, y);
+  }
+  return points;
+}
+
+auto ExpectWithin(const std::vector<geometry::Point2D>& expected,
+                  const std::vector<geometry::Point2D>& actual,
+                  double tolerance) -> void {
+  ASSERT_EQ(expected.size(), actual.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_NEAR(expected[i].GetX(), actual[i].GetX(), tolerance);
+    ASSERT_NEAR(expected[i].GetY(), actual[i].GetY(), tolerance);
+  }
+}
+}  // namespace
+
+namespace geometry {
+
+TEST(GeometryTrajectoryCodec, RoundTripWithinHalfResolution) {
+  for (uint32_t test = 0; test < kTestCount; ++test) {
+    const double resolution{test % 2 == 0 ? 0.01 : 0.25};
+    const auto points{MakeTrace(kPointCount + test, 1.0e5 * test)};
+    const auto bytes{EncodeTrajectory(points, Distance(resolution))};
+    // Half a grid cell plus the rounding of the grid to meters.
+    ExpectWithin(points, DecodeTrajectory(bytes),
+                 resolution * (0.5 + 1e-9) + 1e-9);
+  }
+}
+
+TEST(GeometryTrajectoryCodec, CompressesTraces) {
+  const auto points{MakeTrace(kPointCount, 3.0e5)};
+  const auto bytes{EncodeTrajectory(points, Distance(0.01))};
+  // Two raw doubles take 16 bytes per point.
+  EXPECT_LT(bytes.size() * 4, points.size() * 16);
+
+  // A stationary object costs little more than the block headers.
+  const std::vector<Point2D> parked(kPointCount, Point2D(12.5, -7.25));
+  EXPECT_LT(EncodeTrajectory(parked, Distance(0.01)).size() * 100,
+            parked.size() * 16);
+  ExpectWithin(parked,
+               DecodeTrajectory(EncodeTrajectory(parked, Distance(0.01))), 0.0);
+}
+
+TEST(GeometryTrajectoryCodec, StreamingMatchesBlock) {
+  const auto points{MakeTrace(kPointCount / 10 + 37, 0.0)};
+  TrajectoryEncoder encoder(Distance(1.0, Distance::Type::kCentimeter));
+  TrajectoryDecoder decoder;
+  std::vector<uint8_t> stream;
+  std::vector<Point2D> decoded;
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    encoder.Add(points[i]);
+    if (i % 300 == 0) {
+      encoder.Flush();
+    }
+    // Ship the bytes one at a time and read whatever is complete.
+    for (const uint8_t byte : encoder.TakeBytes()) {
+      stream.push_back(byte);
+      decoder.Feed(&byte, 1);
+      static_cast<void>(decoder.Read(decoded));
+    }
+  }
+  encoder.Flush();
+  decoder.Feed(encoder.GetBytes());
+  stream.insert(stream.end(), encoder.GetBytes().begin(),
+                encoder.GetBytes().end());
+  static_cast<void>(decoder.Read(decoded));
+  EXPECT_EQ(points.size(), decoded.size());
+  EXPECT_TRUE(decoder.IsIdle());
+  EXPECT_EQ(points.size(), encoder.GetPointCount());
+  EXPECT_EQ(Distance(1.0, Distance::Type::kCentimeter),
+            decoder.GetResolution());
+  const auto block{DecodeTrajectory(stream)};
+  ASSERT_EQ(block.size(), decoded.size());
+  TrajectoryDecoder arrays;
+  arrays.Feed(stream);
+  std::vector<double> xs;
+  std::vector<double> ys;
+  EXPECT_EQ(block.size(), arrays.Read(xs, ys));
+  for (std::size_t i = 0; i < block.size(); ++i) {
+    EXPECT_EQ(block[i], decoded[i]);
+    EXPECT_EQ(block[i].GetX(), xs[i]);
+    EXPECT_EQ(block[i].GetY(), ys[i]);
+  }
+  ExpectWithin(points, decoded, 0.005 + 1e-9);
+}
+
+TEST(GeometryTrajectoryCodec, FullWidthDeltas) {
+  // Nanometer grid points far apart need the full 64-bit zigzag range.
+  std::vector<Point2D> points;
+  for (int i = 0; i < 300; ++i) {
+    const double sign{i % 2 == 0 ? 1.0 : -1.0};
+    points.emplace_back(sign * 4.0e9, -sign * (i % 7) * 5.0e8);
+  }
+  const auto decoded{DecodeTrajectory(
+      EncodeTrajectory(points, Distance(1.0, Distance::Type::kNanometer)))};
+  ExpectWithin(points, decoded, 1e-3);
+}
+
+TEST(GeometryTrajectoryCodec, InvalidInput) {
+  EXPECT_THROW(TrajectoryEncoder(Distance(0.0)), std::invalid_argument);
+  EXPECT_THROW(TrajectoryEncoder(Distance(-1.0)), std::invalid_argument);
+  TrajectoryEncoder encoder(Distance(1.0, Distance::Type::kMillimeter));
+  EXPECT_THROW(
+      encoder.Add(Point2D(std::numeric_limits<double>::quiet_NaN(), 0.0)),
+      std::invalid_argument);
+  EXPECT_THROW(encoder.Add({Point2D(1.0, 1.0), Point2D(1.0e18, 0.0)}),
+               std::invalid_argument);
+  EXPECT_EQ(0U, encoder.GetPointCount());
+
+  const auto bytes{EncodeTrajectory(MakeTrace(100, 0.0), Distance(0.01))};
+  EXPECT_THROW(static_cast<void>(DecodeTrajectory({})), std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(DecodeTrajectory(std::vector<uint8_t>(
+                   bytes.begin(), bytes.end() - 1))),
+               std::invalid_argument);
+  auto corrupt{bytes};
+  corrupt[0] = 'X';
+  EXPECT_THROW(static_cast<void>(DecodeTrajectory(corrupt)),
+               std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(TrajectoryDecoder().GetResolution()),
+               std::logic_error);
+  EXPECT_TRUE(DecodeTrajectory(EncodeTrajectory({}, Distance(1.0))).empty());
+}
+
+}  // namespace geometry